@@ -0,0 +1,138 @@
+#ifndef BUDGET_TIMER_HPP
+#define BUDGET_TIMER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+/**
+ * @class BudgetTimer
+ * @brief A deadline checker for cooperative time-slicing that amortizes its clock reads.
+ *
+ * The pattern `Timer t(0.002, true); while (!t.time_up()) do_work();` pays a full clock read
+ * after every work item — hundreds of thousands per frame. BudgetTimer implements the classic
+ * amortized-deadline-check: expired() only touches the real clock every N calls (the stride) and
+ * is a decrement-and-branch in between. The stride is calibrated continuously from the observed
+ * time per call, targeting one clock read per ~5% of the budget, and shrinks as the deadline
+ * nears so the final check cannot overshoot by a whole stride's worth of work.
+ *
+ * The calibration assumes work items of roughly similar cost between two checks; a single
+ * wildly slow item can overshoot the budget by its own duration, which no check-skipping
+ * scheme can avoid.
+ *
+ * Example usage:
+ * @code
+ * BudgetTimer budget(0.002); // 2ms slice, starts immediately
+ * while (!budget.expired())
+ *     do_small_work_item();
+ * @endcode
+ */
+class BudgetTimer {
+  public:
+    /**
+     * @brief Construct and start a budget timer.
+     *
+     * @param budget_seconds The time slice to guard. Must be positive.
+     * @param initial_stride How many expired() calls to allow before the first clock read; after
+     *        that the stride is calibrated automatically.
+     */
+    explicit BudgetTimer(double budget_seconds, std::size_t initial_stride = 32)
+        : budget_nanoseconds(static_cast<std::int64_t>(budget_seconds * 1e9)), deadline_nanoseconds(0),
+          last_check_nanoseconds(0), stride(initial_stride == 0 ? 1 : initial_stride), calls_until_check(0) {
+        // validate the converted count: a positive budget below 1ns truncates to zero
+        if (budget_nanoseconds <= 0) {
+            throw std::invalid_argument("BudgetTimer budget must be at least one nanosecond");
+        }
+        restart();
+    }
+
+    /**
+     * @brief Check whether the budget is spent.
+     *
+     * Between clock reads this is a decrement and a branch; every `stride` calls it reads the
+     * clock, answers exactly, and re-calibrates the stride from the measured cost per call.
+     * Once expired it stays expired until restart().
+     */
+    bool expired() {
+        if (calls_until_check > 0) {
+            calls_until_check--;
+            return false; // amortized fast path: no clock read
+        }
+        std::int64_t now = now_nanoseconds();
+        if (now >= deadline_nanoseconds)
+            return true;
+        recalibrate(now);
+        return false;
+    }
+
+    /**
+     * @brief Restart the slice: the full budget is available again and calibration carries over.
+     */
+    void restart() {
+        deadline_nanoseconds = now_nanoseconds() + budget_nanoseconds;
+        last_check_nanoseconds = deadline_nanoseconds - budget_nanoseconds;
+        calls_until_check = stride;
+    }
+
+    /**
+     * @brief The remaining budget in seconds. Always reads the clock; not for the hot loop.
+     */
+    double get_remaining_time() const {
+        std::int64_t remaining = deadline_nanoseconds - now_nanoseconds();
+        return remaining > 0 ? static_cast<double>(remaining) * 1e-9 : 0.0;
+    }
+
+    /**
+     * @brief The current number of expired() calls between clock reads (for tuning/diagnostics).
+     */
+    std::size_t current_stride() const { return stride; }
+
+  private:
+    /** @brief The stride never grows past this, bounding how stale an expiry answer can be. */
+    static constexpr std::size_t max_stride = 1 << 20;
+
+    /** @brief Read the steady clock as nanoseconds since its epoch. */
+    static std::int64_t now_nanoseconds() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /** @brief Pick the next stride from the measured cost per call and the remaining budget. */
+    void recalibrate(std::int64_t now) {
+        std::int64_t since_last_check = now - last_check_nanoseconds;
+        last_check_nanoseconds = now;
+        // aim for one clock read per ~5% of the budget, but never skip past the deadline
+        std::int64_t remaining = deadline_nanoseconds - now;
+        std::int64_t target_gap = budget_nanoseconds / 20;
+        if (target_gap > remaining)
+            target_gap = remaining;
+        double nanoseconds_per_call = static_cast<double>(since_last_check) / static_cast<double>(stride + 1);
+        std::size_t next_stride = max_stride;
+        if (nanoseconds_per_call > 0.0) {
+            double calls = static_cast<double>(target_gap) / nanoseconds_per_call;
+            next_stride = calls < 1.0 ? 1 : (calls > static_cast<double>(max_stride)
+                                                 ? max_stride
+                                                 : static_cast<std::size_t>(calls));
+        }
+        stride = next_stride;
+        calls_until_check = next_stride;
+    }
+
+    /** @brief The slice length in nanoseconds. */
+    std::int64_t budget_nanoseconds;
+
+    /** @brief The absolute end of the current slice in nanoseconds. */
+    std::int64_t deadline_nanoseconds;
+
+    /** @brief When the clock was last read, for measuring cost per call. */
+    std::int64_t last_check_nanoseconds;
+
+    /** @brief Current calls-per-clock-read. */
+    std::size_t stride;
+
+    /** @brief Countdown until the next clock read. */
+    std::size_t calls_until_check;
+};
+
+#endif // BUDGET_TIMER_HPP
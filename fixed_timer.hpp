@@ -0,0 +1,130 @@
+#ifndef FIXED_TIMER_HPP
+#define FIXED_TIMER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+/**
+ * @class FixedTimer
+ * @brief A timer whose duration is a compile-time constant, shrinking it to one 8-byte word.
+ *
+ * Many timers have durations fixed at build time — a 16.67ms frame budget, a 5s heartbeat.
+ * Baking the duration into the type removes the runtime duration field (half the storage of
+ * Timer) and change_duration() with it, and lets the duration fold into the time_up() call site
+ * as an immediate: started timers are a load and a compare against a constant-offset deadline.
+ *
+ * @tparam Period A std::ratio giving the duration in seconds, e.g. `std::ratio<1, 60>` for a
+ *         60Hz frame budget or `std::ratio<5>` for a 5s heartbeat.
+ * @tparam Clock The time source, as in BasicTimer; defaults to std::chrono::steady_clock.
+ *
+ * Example usage:
+ * @code
+ * FixedTimer<std::ratio<1, 60>> frame_budget; // 16.67ms, sizeof == 8
+ * frame_budget.start();
+ * while (!frame_budget.time_up())
+ *     do_frame_work();
+ * @endcode
+ */
+template <typename Period, typename Clock = std::chrono::steady_clock> class FixedTimer {
+  public:
+    /** @brief The time point type of the underlying clock. */
+    using time_point = typename Clock::time_point;
+
+    /** @brief The fixed duration in nanoseconds, resolved at compile time. */
+    static constexpr std::int64_t duration_nanoseconds = Period::num * INT64_C(1000000000) / Period::den;
+
+    static_assert(duration_nanoseconds > 0, "FixedTimer duration must be positive");
+
+    /**
+     * @brief Construct the timer, not yet started; the duration comes from the type.
+     */
+    constexpr FixedTimer() noexcept : deadline_nanoseconds(not_started) {}
+
+    /**
+     * @brief Start or restart the timer.
+     */
+    void start() { start(Clock::now()); }
+
+    /**
+     * @brief Cached-clock version of start().
+     */
+    void start(time_point now) { deadline_nanoseconds = to_nanoseconds(now) + duration_nanoseconds; }
+
+    /**
+     * @brief Check whether the fixed duration has elapsed; false before start().
+     */
+    bool time_up() const { return time_up(Clock::now()); }
+
+    /**
+     * @brief Cached-clock version of time_up().
+     */
+    bool time_up(time_point now) const {
+        return deadline_nanoseconds != not_started && to_nanoseconds(now) >= deadline_nanoseconds;
+    }
+
+    /**
+     * @brief Check for expiry and restart on expiry, both against one time sample.
+     */
+    bool time_up_and_try_to_restart() { return time_up_and_try_to_restart(Clock::now()); }
+
+    /**
+     * @brief Cached-clock version of time_up_and_try_to_restart().
+     */
+    bool time_up_and_try_to_restart(time_point now) {
+        bool time_is_up = time_up(now);
+        if (time_is_up)
+            start(now);
+        return time_is_up;
+    }
+
+    /**
+     * @brief Remaining time in seconds: the full duration before start, zero after expiry.
+     */
+    double get_remaining_time() const { return get_remaining_time(Clock::now()); }
+
+    /**
+     * @brief Cached-clock version of get_remaining_time().
+     */
+    double get_remaining_time(time_point now) const {
+        if (deadline_nanoseconds == not_started)
+            return static_cast<double>(duration_nanoseconds) * 1e-9;
+        std::int64_t remaining = deadline_nanoseconds - to_nanoseconds(now);
+        return remaining > 0 ? static_cast<double>(remaining) * 1e-9 : 0.0;
+    }
+
+    /**
+     * @brief Completion fraction in [0, 1]; zero before start.
+     */
+    double get_percent_complete() const { return get_percent_complete(Clock::now()); }
+
+    /**
+     * @brief Cached-clock version of get_percent_complete().
+     */
+    double get_percent_complete(time_point now) const {
+        if (deadline_nanoseconds == not_started)
+            return 0.0;
+        std::int64_t elapsed = to_nanoseconds(now) - (deadline_nanoseconds - duration_nanoseconds);
+        double progress = static_cast<double>(elapsed) / static_cast<double>(duration_nanoseconds);
+        return progress < 1.0 ? progress : 1.0;
+    }
+
+  private:
+    /** @brief Deadline encoding: the timer has not been started. */
+    static constexpr std::int64_t not_started = INT64_MIN;
+
+    /** @brief Convert a clock time point to nanoseconds since the clock epoch. */
+    static std::int64_t to_nanoseconds(time_point time_point_value) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point_value.time_since_epoch()).count();
+    }
+
+    /** @brief The absolute expiry deadline in nanoseconds, or `not_started`. The whole object. */
+    std::int64_t deadline_nanoseconds;
+};
+
+static_assert(sizeof(FixedTimer<std::ratio<1, 60>>) == 8, "FixedTimer must stay a single 8-byte word");
+static_assert(std::is_trivially_copyable<FixedTimer<std::ratio<1, 60>>>::value,
+              "FixedTimer must be trivially copyable");
+
+#endif // FIXED_TIMER_HPP
@@ -0,0 +1,102 @@
+#ifndef MANUAL_CLOCK_HPP
+#define MANUAL_CLOCK_HPP
+
+#include "timer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @class ManualAccumulatorClock
+ * @brief A clock policy whose time is an accumulator advanced by the caller, one tick() per frame.
+ *
+ * Engines already compute a per-frame `dt`; reading the wall clock again inside every timer
+ * query is redundant work and desyncs timers from the simulation step. ManualAccumulatorClock
+ * follows the standard clock interface, so it plugs straight into BasicTimer: call
+ * tick(dt) once at the top of the frame and every timer on the clock answers time_up() /
+ * get_percent_complete() from the accumulator with zero clock reads — and since the accumulator
+ * only moves when you move it, timer behavior is exactly reproducible across runs.
+ *
+ * The time source is static, so all timers on one instantiation share a timeline and one tick()
+ * updates them all. The @p Timeline tag makes instantiations independent: timers on
+ * `ManualAccumulatorClock<struct ui_timeline>` are untouched by ticks to the simulation
+ * timeline, which is how you pause gameplay without freezing UI animations.
+ *
+ * Example usage:
+ * @code
+ * // 40k gameplay timers, zero steady_clock::now() calls per frame:
+ * TickTimer attack_cooldown(0.8, true);
+ * void frame(double dt) {
+ *     FrameClock::tick(dt);
+ *     if (attack_cooldown.time_up()) { ... }
+ * }
+ * @endcode
+ *
+ * @tparam Timeline A tag type naming the timeline; every distinct tag gets its own accumulator.
+ */
+template <typename Timeline> class ManualAccumulatorClock {
+  public:
+    using rep = std::int64_t;
+    using period = std::nano;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<ManualAccumulatorClock, duration>;
+
+    /** @brief Time never goes backwards through tick()/advance(); set() is the caller's contract. */
+    static constexpr bool is_steady = false;
+
+    /**
+     * @brief The current accumulated time. Never reads a real clock.
+     */
+    static time_point now() noexcept {
+        return time_point(duration(current_nanoseconds.load(std::memory_order_relaxed)));
+    }
+
+    /**
+     * @brief Advance the timeline by one frame's delta. Negative steps are ignored.
+     */
+    static void tick(double dt_seconds) noexcept { advance(dt_seconds); }
+
+    /**
+     * @brief Step the timeline forward by `seconds`. Negative steps are ignored.
+     */
+    static void advance(double seconds) noexcept {
+        if (seconds <= 0.0)
+            return;
+        current_nanoseconds.fetch_add(static_cast<std::int64_t>(seconds * 1e9), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Step the timeline forward by an exact duration. Negative steps are ignored.
+     */
+    static void advance(duration step) noexcept {
+        if (step <= duration::zero())
+            return;
+        current_nanoseconds.fetch_add(step.count(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Jump the timeline to an absolute point. Moving backwards confuses running timers;
+     *        reserve it for (re)initializing a run.
+     */
+    static void set(time_point value) noexcept {
+        current_nanoseconds.store(value.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Rewind the timeline to zero, e.g. between runs.
+     */
+    static void reset() noexcept { current_nanoseconds.store(0, std::memory_order_relaxed); }
+
+  private:
+    /** @brief Accumulated nanoseconds since the (arbitrary) epoch; shared by every reader of this timeline. */
+    static inline std::atomic<std::int64_t> current_nanoseconds{0};
+};
+
+/** @brief The default simulation timeline for frame loops. */
+using FrameClock = ManualAccumulatorClock<struct frame_timeline_tag>;
+
+/** @brief A timer driven by the frame loop's accumulated dt. */
+using TickTimer = BasicTimer<FrameClock>;
+
+#endif // MANUAL_CLOCK_HPP
@@ -0,0 +1,147 @@
+#ifndef SHARED_TIMER_HPP
+#define SHARED_TIMER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+/**
+ * @class SharedTimer
+ * @brief A lock-free timer that is safe to start, poll and reconfigure from multiple threads.
+ *
+ * Timer is single-threaded: start() writes its fields non-atomically while a concurrent
+ * time_up() reads them, which is a data race. SharedTimer packs all state into two atomic
+ * 64-bit words — the absolute nanosecond deadline (with a sentinel meaning "not running") and
+ * the duration — so every operation is a single atomic load, store or compare-exchange with no
+ * mutex anywhere. A watchdog thread can poll a timer owned by a worker thread at full speed
+ * while the worker restarts it.
+ *
+ * time_up_and_try_to_restart() uses compare-exchange so that when several threads observe the
+ * same expiry, exactly one of them wins the restart and sees true; the others see false. This
+ * makes "do X once per period" safe without external coordination.
+ *
+ * The class is header-only and all methods are inline for the same reason Timer's hot paths
+ * are: polling loops should compile down to an atomic load and an integer compare.
+ */
+class SharedTimer {
+  public:
+    /**
+     * @brief Construct a new SharedTimer with a specified duration.
+     *
+     * @param duration_seconds The duration of the timer in seconds.
+     * @param start_immediately If true, the timer starts immediately upon construction.
+     */
+    explicit SharedTimer(double duration_seconds, bool start_immediately = false)
+        : deadline_nanoseconds(not_running),
+          duration_nanoseconds(static_cast<std::int64_t>(duration_seconds * 1e9)) {
+        // validate the converted count: a positive duration below 1ns truncates to zero
+        if (duration_nanoseconds.load(std::memory_order_relaxed) <= 0) {
+            throw std::invalid_argument("SharedTimer duration must be at least one nanosecond");
+        }
+        if (start_immediately)
+            this->start();
+    }
+
+    /**
+     * @brief Start or restart the timer. Wait-free; callable from any thread.
+     */
+    void start() { start(std::chrono::steady_clock::now()); }
+
+    /**
+     * @brief Cached-clock version of start().
+     */
+    void start(std::chrono::steady_clock::time_point now) {
+        deadline_nanoseconds.store(to_nanoseconds(now) + duration_nanoseconds.load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Stop the timer without expiring it. Wait-free; callable from any thread.
+     */
+    void stop() { deadline_nanoseconds.store(not_running, std::memory_order_relaxed); }
+
+    /**
+     * @brief Check whether the timer duration has elapsed. Wait-free; callable from any thread.
+     *
+     * Returns false if the timer has not been started (the sentinel deadline compares later than
+     * any real time).
+     */
+    bool time_up() const { return time_up(std::chrono::steady_clock::now()); }
+
+    /**
+     * @brief Cached-clock version of time_up().
+     */
+    bool time_up(std::chrono::steady_clock::time_point now) const {
+        return deadline_nanoseconds.load(std::memory_order_relaxed) <= to_nanoseconds(now);
+    }
+
+    /**
+     * @brief Atomically check for expiry and restart on success.
+     *
+     * @return true only for the thread whose compare-exchange wins the restart; concurrent
+     *         callers observing the same expiry get false. Lock-free: a failed exchange means
+     *         another thread already restarted, so no retry is needed.
+     */
+    bool time_up_and_try_to_restart() { return time_up_and_try_to_restart(std::chrono::steady_clock::now()); }
+
+    /**
+     * @brief Cached-clock version of time_up_and_try_to_restart().
+     */
+    bool time_up_and_try_to_restart(std::chrono::steady_clock::time_point now) {
+        std::int64_t now_nanoseconds = to_nanoseconds(now);
+        std::int64_t observed = deadline_nanoseconds.load(std::memory_order_relaxed);
+        if (observed > now_nanoseconds)
+            return false; // not expired (or not running)
+        std::int64_t restarted = now_nanoseconds + duration_nanoseconds.load(std::memory_order_relaxed);
+        return deadline_nanoseconds.compare_exchange_strong(observed, restarted, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the remaining time in seconds. Wait-free; callable from any thread.
+     *
+     * Mirrors Timer::get_remaining_time(): the full duration before start, zero after expiry.
+     */
+    double get_remaining_time() const { return get_remaining_time(std::chrono::steady_clock::now()); }
+
+    /**
+     * @brief Cached-clock version of get_remaining_time().
+     */
+    double get_remaining_time(std::chrono::steady_clock::time_point now) const {
+        std::int64_t deadline = deadline_nanoseconds.load(std::memory_order_relaxed);
+        if (deadline == not_running)
+            return static_cast<double>(duration_nanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+        std::int64_t remaining = deadline - to_nanoseconds(now);
+        return remaining > 0 ? static_cast<double>(remaining) * 1e-9 : 0.0;
+    }
+
+    /**
+     * @brief Change the duration of the timer. Wait-free; callable from any thread.
+     *
+     * Affects the next start()/restart; a deadline already in flight is not adjusted, since
+     * doing both atomically would require widening the state beyond one word.
+     */
+    void change_duration(double duration_seconds) {
+        std::int64_t new_duration = static_cast<std::int64_t>(duration_seconds * 1e9);
+        if (new_duration <= 0)
+            return; // duration must stay at least one nanosecond
+        duration_nanoseconds.store(new_duration, std::memory_order_relaxed);
+    }
+
+  private:
+    /** @brief Deadline sentinel for a timer that is not running; compares later than any real time. */
+    static constexpr std::int64_t not_running = INT64_MAX;
+
+    /** @brief Convert a steady_clock time point to nanoseconds since the clock epoch. */
+    static std::int64_t to_nanoseconds(std::chrono::steady_clock::time_point time_point) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point.time_since_epoch()).count();
+    }
+
+    /** @brief The absolute expiry deadline in nanoseconds, or `not_running`. */
+    std::atomic<std::int64_t> deadline_nanoseconds;
+
+    /** @brief The total duration of the timer in nanoseconds. */
+    std::atomic<std::int64_t> duration_nanoseconds;
+};
+
+#endif // SHARED_TIMER_HPP
@@ -0,0 +1,175 @@
+#ifndef SHM_TIMER_HPP
+#define SHM_TIMER_HPP
+
+#include "timer_batch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @class ShmTimerTable
+ * @brief A fixed-capacity timer table designed to live in shared memory for cross-process polling.
+ *
+ * SharedTimer makes one timer safe across threads; this makes a whole table of them safe across
+ * processes. The intended shape is one supervisor watching per-worker liveness deadlines: the
+ * supervisor maps the table into every process (mmap of a shm segment sized sizeof(ShmTimerTable)),
+ * each worker owns one slot and restarts its deadline with a single relaxed atomic store, and the
+ * supervisor polls all slots with one clock read and one vectorized batch_time_up() scan — no
+ * pipes, no syscalls, no locks on either side.
+ *
+ * The layout is struct-of-arrays like TimerPool's: all deadlines are contiguous lock-free 8-byte
+ * words, which is exactly the array the SIMD batch kernel wants. Durations sit in a parallel
+ * array written only by each slot's owner (set_duration() before the first start()), so the hot
+ * path — restart and scan — never touches them.
+ *
+ * The supervisor must call initialize() once before workers attach: a freshly created shm segment
+ * is zero-filled, and a zero deadline would read as "expired at the clock epoch".
+ *
+ * Deadlines are nanoseconds since the steady_clock epoch. steady_clock's epoch is shared by every
+ * process on the machine on the platforms we target (it is the boot-time clock), which is what
+ * makes cross-process comparison of absolute deadlines meaningful.
+ *
+ * Example usage:
+ * @code
+ * // supervisor, once, in freshly mapped shm:
+ * auto *table = new (shm_base) ShmTimerTable<64>;
+ * table->initialize();
+ *
+ * // worker i, on attach and then every loop iteration:
+ * table->set_duration(i, 1.0); // liveness deadline: 1s without a restart means stuck
+ * table->start(i);
+ *
+ * // supervisor, each watchdog tick:
+ * std::uint64_t mask[ShmTimerTable<64>::mask_words];
+ * table->poll_expired_mask(mask);
+ * @endcode
+ *
+ * @tparam Capacity The number of timer slots; fixed at compile time so the table is one
+ *         contiguous block whose size is known when the shm segment is created.
+ */
+template <std::size_t Capacity> class ShmTimerTable {
+  public:
+    /** @brief The number of slots in the table. */
+    static constexpr std::size_t capacity = Capacity;
+
+    /** @brief The number of 64-bit words poll_expired_mask() writes. */
+    static constexpr std::size_t mask_words = batch_mask_words(Capacity);
+
+    /**
+     * @brief Mark every slot not-running. Call exactly once, before any worker attaches.
+     */
+    void initialize() {
+        for (std::size_t i = 0; i < Capacity; i++) {
+            deadlines[i].store(never, std::memory_order_relaxed);
+            durations[i] = 0;
+        }
+    }
+
+    /**
+     * @brief Set a slot's duration. Owner-side; call before the slot's first start().
+     *
+     * Not synchronized against concurrent start() on the same slot — the slot's owner is the
+     * only writer of both words, so ordinary program order suffices.
+     */
+    void set_duration(std::size_t slot, double duration_seconds) {
+        std::int64_t duration_nanoseconds = static_cast<std::int64_t>(duration_seconds * 1e9);
+        if (duration_nanoseconds <= 0)
+            return; // duration must be at least one nanosecond; a zero would expire on start()
+        durations[slot] = duration_nanoseconds;
+    }
+
+    /**
+     * @brief Start or restart a slot's timer: one relaxed atomic store, wait-free.
+     */
+    void start(std::size_t slot) { start(slot, std::chrono::steady_clock::now()); }
+
+    /**
+     * @brief Cached-clock version of start().
+     */
+    void start(std::size_t slot, std::chrono::steady_clock::time_point now) {
+        deadlines[slot].store(to_nanoseconds(now) + durations[slot], std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Stop a slot's timer without expiring it (e.g. on clean worker shutdown).
+     */
+    void stop(std::size_t slot) { deadlines[slot].store(never, std::memory_order_relaxed); }
+
+    /**
+     * @brief Check a single slot for expiry; false for slots that are not running.
+     */
+    bool time_up(std::size_t slot) const { return time_up(slot, std::chrono::steady_clock::now()); }
+
+    /**
+     * @brief Cached-clock version of time_up().
+     */
+    bool time_up(std::size_t slot, std::chrono::steady_clock::time_point now) const {
+        return deadlines[slot].load(std::memory_order_relaxed) <= to_nanoseconds(now);
+    }
+
+    /**
+     * @brief Supervisor-side scan: one clock read, one batch_time_up() pass over every slot.
+     *
+     * @param out_mask Output array of mask_words words; bit `i % 64` of word `i / 64` is set
+     *        when slot `i` has expired. Slots never started (or stopped) hold the sentinel and
+     *        never report expired.
+     */
+    void poll_expired_mask(std::uint64_t *out_mask) const {
+        poll_expired_mask(std::chrono::steady_clock::now(), out_mask);
+    }
+
+    /**
+     * @brief Cached-clock version of poll_expired_mask().
+     */
+    void poll_expired_mask(std::chrono::steady_clock::time_point now, std::uint64_t *out_mask) const {
+        // a lock-free atomic int64 has the same object representation as a plain int64 (asserted
+        // below), so the kernel can scan the deadline array in place; the reads are as-if relaxed
+        batch_time_up(reinterpret_cast<const std::int64_t *>(deadlines), Capacity, to_nanoseconds(now), out_mask);
+    }
+
+    /**
+     * @brief Remaining time in seconds for one slot; the full duration before start, zero after
+     *        expiry.
+     */
+    double get_remaining_time(std::size_t slot) const {
+        return get_remaining_time(slot, std::chrono::steady_clock::now());
+    }
+
+    /**
+     * @brief Cached-clock version of get_remaining_time().
+     */
+    double get_remaining_time(std::size_t slot, std::chrono::steady_clock::time_point now) const {
+        std::int64_t deadline = deadlines[slot].load(std::memory_order_relaxed);
+        if (deadline == never)
+            return static_cast<double>(durations[slot]) * 1e-9;
+        std::int64_t remaining = deadline - to_nanoseconds(now);
+        return remaining > 0 ? static_cast<double>(remaining) * 1e-9 : 0.0;
+    }
+
+  private:
+    /** @brief Deadline sentinel for slots that are not running; compares later than any real time. */
+    static constexpr std::int64_t never = INT64_MAX;
+
+    /** @brief Convert a steady_clock time point to nanoseconds since the clock epoch. */
+    static std::int64_t to_nanoseconds(std::chrono::steady_clock::time_point time_point) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point.time_since_epoch()).count();
+    }
+
+    /** @brief Absolute expiry deadlines in nanoseconds, `never` for slots not running. */
+    std::atomic<std::int64_t> deadlines[Capacity];
+
+    /** @brief Slot durations in nanoseconds; written only by each slot's owner. */
+    std::int64_t durations[Capacity];
+};
+
+static_assert(std::atomic<std::int64_t>::is_always_lock_free,
+              "ShmTimerTable requires lock-free 64-bit atomics (a mutex-backed atomic cannot live in shm)");
+static_assert(sizeof(std::atomic<std::int64_t>) == sizeof(std::int64_t),
+              "ShmTimerTable scans the atomic deadline array as plain int64s");
+static_assert(std::is_standard_layout<ShmTimerTable<1>>::value,
+              "ShmTimerTable must have a layout every process agrees on");
+
+#endif // SHM_TIMER_HPP
@@ -2,15 +2,93 @@
 #define TIMER_HPP
 
 #include <chrono>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+/** @brief Tag selecting the non-validating, non-throwing timer constructor. */
+struct timer_unchecked_t {
+    explicit timer_unchecked_t() = default;
+};
+
+/** @brief Tag value for the non-validating, non-throwing timer constructor. */
+inline constexpr timer_unchecked_t timer_unchecked{};
 
 /**
- * @class Timer
- * @brief A simple timer utility for measuring elapsed time.
+ * @struct TimerSnapshot
+ * @brief A fixed-size POD record capturing a timer's state for migration or persistence.
  *
- * The `Timer` class provides a straightforward way to measure a fixed duration.
+ * Stores remaining time as exact nanoseconds rather than double seconds, so a save/restore
+ * round-trip is lossless. Records are trivially copyable, so a contiguous array of timers
+ * snapshots with one memcpy-like pass via save_all()/restore_all() and the record can be written
+ * straight into a wire buffer or mapped file.
+ */
+struct TimerSnapshot {
+    /** @brief Remaining nanoseconds at capture time (zero when expired or never started). */
+    std::int64_t remaining_nanoseconds;
+
+    /** @brief The timer's duration in nanoseconds. */
+    std::int64_t duration_nanoseconds;
+
+    /** @brief State bits; see the running/paused flag constants. */
+    std::uint8_t flags;
+
+    /** @brief Padding reserved for future use; written as zero. */
+    std::uint8_t reserved[7];
+
+    /** @brief Flag bit: the timer was running at capture time. */
+    static constexpr std::uint8_t flag_running = 1 << 0;
+
+    /** @brief Flag bit: the timer was paused at capture time. */
+    static constexpr std::uint8_t flag_paused = 1 << 1;
+};
+
+static_assert(std::is_trivially_copyable<TimerSnapshot>::value, "TimerSnapshot must be trivially copyable");
+static_assert(sizeof(TimerSnapshot) == 24, "TimerSnapshot is a fixed-size wire record");
+
+/**
+ * @struct TimerStatsOff
+ * @brief The default stats policy: instrumentation compiled out entirely.
+ *
+ * With this policy the timer carries zero extra bytes and time_up() contains zero extra
+ * instructions. See timer_stats.hpp for the opt-in thread-local histogram policy.
+ */
+struct TimerStatsOff {
+    /** @brief Selects the instrumentation-free code path at compile time. */
+    static constexpr bool enabled = false;
+
+    /** @brief No-op; never emitted. */
+    static void record_poll(bool /*expired*/, std::int64_t /*overshoot_nanoseconds*/) noexcept {}
+};
+
+/** @brief Per-object state carried only when a stats policy is enabled. */
+struct timer_stats_state {
+    /** @brief Whether this timer's expiry overshoot was already recorded (first true time_up() only). */
+    mutable bool overshoot_recorded;
+};
+
+/** @brief Empty stand-in so the instrumentation-off build carries no state (empty base optimization). */
+struct timer_stats_state_off {};
+
+/**
+ * @class BasicTimer
+ * @brief A simple timer utility for measuring elapsed time, parameterized on its clock source.
+ *
+ * The `BasicTimer` class provides a straightforward way to measure a fixed duration.
  * Once started, it tracks elapsed time and allows checking whether the timer has
  * expired, retrieving remaining time, or determining the percent completion.
  *
+ * @tparam Clock The time source, following the standard clock interface: a static `now()`
+ *         returning `Clock::time_point`. `Timer` is the alias for the common
+ *         `std::chrono::steady_clock` case; supply another clock where the default is too slow
+ *         (e.g. a coarse CLOCK_MONOTONIC wrapper inside containers that filter the vDSO, or an
+ *         rdtsc-based clock) or where time must be controlled (replay, simulation). The clock
+ *         must be monotonic for the timer's math to make sense.
+ * @tparam Stats The instrumentation policy. The default, TimerStatsOff, compiles every hook out;
+ *         see timer_stats.hpp for the opt-in policy that records poll counts and expiry
+ *         overshoot into per-thread histograms.
+ *
  * Example usage:
  * @code
  * // Create a 3-second timer, but don't start it yet
@@ -35,17 +113,67 @@
  * std::cout << "Timer restarted." << std::endl;
  * @endcode
  */
-class Timer {
+template <typename Clock, typename Stats = TimerStatsOff>
+class BasicTimer : private std::conditional<Stats::enabled, timer_stats_state, timer_stats_state_off>::type {
   public:
+    /** @brief The time point type of the underlying clock. */
+    using time_point = typename Clock::time_point;
+
     /**
-     * @brief Construct a new Timer with a specified duration.
+     * @brief Construct a new timer with a specified duration.
      *
      * @param duration_seconds The duration of the timer in seconds.
      * @param start_immediately If true, the timer starts immediately upon construction.
      *
      * If `start_immediately` is false (default), you must call start() manually.
      */
-    explicit Timer(double duration_seconds, bool start_immediately = false);
+    explicit BasicTimer(double duration_seconds, bool start_immediately = false)
+        : deadline_nanoseconds(not_started), duration_nanoseconds(static_cast<std::int64_t>(duration_seconds * 1e9)) {
+
+        // validate the converted count, not the double: a positive duration below 1ns truncates
+        // to zero, and a zero duration would divide by zero in the periodic restart and
+        // percent-complete paths
+        if (duration_nanoseconds <= 0) {
+            throw std::invalid_argument("Timer duration must be at least one nanosecond");
+        }
+
+        if constexpr (Stats::enabled)
+            this->overshoot_recorded = false;
+
+        if (start_immediately)
+            this->start();
+    }
+
+    /**
+     * @brief Construct a timer without validating the duration; never throws.
+     *
+     * @param duration_seconds The duration of the timer in seconds. Must be at least one
+     *        nanosecond; passing a smaller value is undefined (use create() when the value is
+     *        untrusted).
+     *
+     * This is the path for -fno-exceptions builds and for bulk placement-new into arenas, where
+     * element-wise throwing constructors are unusable. It is constexpr, so timers can also be
+     * built at compile time.
+     */
+    constexpr BasicTimer(timer_unchecked_t, double duration_seconds) noexcept
+        : deadline_nanoseconds(not_started), duration_nanoseconds(static_cast<std::int64_t>(duration_seconds * 1e9)) {
+        if constexpr (Stats::enabled)
+            this->overshoot_recorded = false;
+    }
+
+    /**
+     * @brief Validating, non-throwing factory.
+     *
+     * @return The timer, or std::nullopt if `duration_seconds` is less than one nanosecond.
+     */
+    static std::optional<BasicTimer> create(double duration_seconds, bool start_immediately = false) noexcept {
+        BasicTimer timer(timer_unchecked, duration_seconds);
+        if (timer.duration_nanoseconds <= 0)
+            return std::nullopt;
+        if (start_immediately)
+            timer.start();
+        return timer;
+    }
 
     /**
      * @brief Start or restart the timer.
@@ -55,6 +183,16 @@ class Timer {
      */
     void start();
 
+    /**
+     * @brief Start or restart the timer relative to an externally sampled time point.
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     *
+     * Useful when starting many timers in the same tick: sample the clock once and pass the
+     * same `now` to each timer instead of paying one clock read per start.
+     */
+    void start(time_point now);
+
     /**
      * @brief Check whether the timer duration has elapsed.
      *
@@ -64,12 +202,66 @@ class Timer {
      */
     bool time_up() const;
 
+    /**
+     * @brief Check whether the timer duration has elapsed, measured against a caller-supplied time point.
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     *
+     * This is the cached-clock fast path: when polling many timers per tick, sample the clock once
+     * per tick and pass the same `now` to every query, amortizing a single clock read across all of
+     * them. Behaves exactly like time_up() otherwise.
+     */
+    bool time_up(time_point now) const;
+
     /**
      * @brief internally runs time_up, and then if it is it starts the timer over again
      *
      * @return @see time_up
      */
     bool time_up_and_try_to_restart();
+
+    /**
+     * @brief Cached-clock version of time_up_and_try_to_restart().
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     *
+     * Both the expiry check and the restart use the supplied `now`, so a restarted timer measures
+     * its next interval from the cached timestamp rather than from a fresh clock read.
+     */
+    bool time_up_and_try_to_restart(time_point now);
+
+    /**
+     * @brief How a periodic restart treats periods that were missed because polling fell behind.
+     */
+    enum class MissedPeriodPolicy {
+        /** @brief Skip missed periods: the next deadline is the first period boundary after `now`. */
+        skip_missed_periods,
+        /** @brief Advance one period per call, so each missed period still produces one firing. */
+        fire_once_per_missed_period,
+    };
+
+    /**
+     * @brief Drift-free periodic variant of time_up_and_try_to_restart().
+     *
+     * time_up_and_try_to_restart() restarts from `now`, so the lateness of each poll accumulates:
+     * a 10ms timer polled every ~1ms slips by up to 1ms per period. This variant instead advances
+     * the deadline by exactly `duration` from the previous deadline, keeping firings locked to a
+     * fixed period grid no matter how late each poll lands.
+     *
+     * @param policy What to do when more than one whole period has been missed
+     *        (@see MissedPeriodPolicy). Defaults to skipping missed periods.
+     * @return true if the timer had expired (and its deadline was advanced).
+     */
+    bool time_up_and_restart_periodic(MissedPeriodPolicy policy = MissedPeriodPolicy::skip_missed_periods);
+
+    /**
+     * @brief Cached-clock version of time_up_and_restart_periodic().
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     */
+    bool time_up_and_restart_periodic(time_point now,
+                                      MissedPeriodPolicy policy = MissedPeriodPolicy::skip_missed_periods);
+
     /**
      * @brief Get the remaining time before the timer expires.
      *
@@ -79,6 +271,13 @@ class Timer {
      */
     double get_remaining_time() const;
 
+    /**
+     * @brief Cached-clock version of get_remaining_time().
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     */
+    double get_remaining_time(time_point now) const;
+
     /**
      * @brief changes the duration of the timer
      *
@@ -89,6 +288,70 @@ class Timer {
      */
     void change_duration(double duration_seconds);
 
+    /**
+     * @brief Scale the duration by `factor` while preserving the completion fraction.
+     *
+     * change_duration() keeps the original start time, which is exactly what makes
+     * get_percent_complete() jump discontinuously (see its note). rescale() instead scales the
+     * remaining time by the same factor as the duration, so percent-complete is continuous
+     * across the change — the property a difficulty-scaling system needs when it stretches or
+     * shrinks thousands of in-flight timers. Factors that are not positive are ignored.
+     */
+    void rescale(double factor);
+
+    /**
+     * @brief Cached-clock version of rescale(); use rescale_all() to share one sample over many timers.
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     */
+    void rescale(double factor, time_point now);
+
+    /**
+     * @brief Pause the timer, freezing its remaining time.
+     *
+     * While paused, time_up(), get_remaining_time() and get_percent_complete() keep answering
+     * from the frozen state. Pausing a timer that is not running (or already paused) does
+     * nothing. Costs one clock read; use the cached-clock overload to pause many timers off a
+     * shared timestamp.
+     */
+    void pause();
+
+    /**
+     * @brief Cached-clock version of pause().
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     */
+    void pause(time_point now);
+
+    /**
+     * @brief Resume a paused timer from its frozen remaining time.
+     *
+     * Rebuilds the deadline with a single clock read; no duration round-trips through double
+     * seconds, so pause/resume cycles lose no precision. Resuming a timer that is not paused
+     * does nothing.
+     */
+    void resume();
+
+    /**
+     * @brief Cached-clock version of resume().
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     */
+    void resume(time_point now);
+
+    /**
+     * @brief Whether the timer is currently paused.
+     */
+    bool is_paused() const;
+
+    /**
+     * @brief Whether the timer is running (started and not paused).
+     *
+     * A timer that is not running can never expire on its own; containers and waiters should
+     * check this before deriving anything from its remaining time.
+     */
+    bool is_running() const;
+
     /**
      * @brief Get the completion percentage of the timer.
      *
@@ -98,15 +361,410 @@ class Timer {
      */
     double get_percent_complete() const;
 
+    /**
+     * @brief Cached-clock version of get_percent_complete().
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     */
+    double get_percent_complete(time_point now) const;
+
+    /**
+     * @brief Derive a child timer that shares this timer's absolute deadline.
+     *
+     * The RPC deadline-propagation primitive: instead of rebuilding a child from
+     * get_remaining_time() — a clock read, a double round-trip and a throwing constructor per
+     * call stage, with rounding that can push the child past the parent — the child copies the
+     * parent's integer deadline directly. No clock read, no floating point, never throws, and
+     * the child can never outlive the parent's deadline.
+     *
+     * @param margin_seconds Optional safety margin subtracted from the deadline, so the child
+     *        gives up slightly before the parent (e.g. leaving time to send a cancellation).
+     * @return A running child expiring at (parent deadline - margin); paused and never-started
+     *         parents produce children in the same state.
+     */
+    BasicTimer derive_child(double margin_seconds = 0.0) const noexcept;
+
+    /**
+     * @brief Capture the timer's state as a compact binary record.
+     *
+     * Remaining time is stored as exact nanoseconds (no round-trip through double seconds), so
+     * restore() reproduces the timer bit-for-bit relative to the destination clock. Never
+     * allocates.
+     */
+    TimerSnapshot save() const;
+
+    /**
+     * @brief Cached-clock version of save().
+     *
+     * @param now A time point sampled from the timer's clock by the caller.
+     */
+    TimerSnapshot save(time_point now) const;
+
+    /**
+     * @brief Rebuild a timer from a snapshot; never throws.
+     *
+     * A running snapshot resumes counting down its remaining time from the local clock; paused
+     * and never-started snapshots come back in those states.
+     */
+    static BasicTimer restore(const TimerSnapshot &snapshot);
+
+    /**
+     * @brief Cached-clock version of restore().
+     *
+     * @param now A time point sampled from the destination clock by the caller; useful when
+     *        restoring a whole world of timers off one clock read.
+     */
+    static BasicTimer restore(const TimerSnapshot &snapshot, time_point now);
+
   private:
-    /** @brief The total duration of the timer. */
-    std::chrono::duration<double> duration;
+    /** @brief Convert a clock time point to nanoseconds since the clock epoch. */
+    static std::int64_t to_nanoseconds(time_point time_point_value);
+
+    /** @brief Deadline encoding: the timer has not been started. */
+    static constexpr std::int64_t not_started = INT64_MIN;
+
+    /** @brief Whether the deadline word encodes the running (started, unpaused) state. */
+    bool is_running_state() const { return deadline_nanoseconds >= 0; }
+
+    /** @brief Whether the deadline word encodes the paused state. */
+    bool is_paused_state() const { return deadline_nanoseconds < 0 && deadline_nanoseconds != not_started; }
 
-    /** @brief The time point when the timer was started. */
-    std::chrono::steady_clock::time_point start_time;
+    /**
+     * @brief The absolute expiry deadline in nanoseconds since the clock epoch, with the run
+     *        state folded into the same word so the whole timer is 16 bytes.
+     *
+     * Precomputed once by start() so that time_up() is a single integer compare against `now`,
+     * with no duration arithmetic or floating-point conversion on the polling path. Non-negative
+     * values are running deadlines (the clock's now() must not be negative, which holds for
+     * every clock this subproject ships); `not_started` means exactly that; any other negative
+     * value is a paused timer storing its frozen remaining time bitwise-complemented
+     * (remaining == ~deadline_nanoseconds).
+     */
+    std::int64_t deadline_nanoseconds;
 
-    /** @brief Whether the timer is currently running. */
-    bool running;
+    /** @brief The total duration of the timer in nanoseconds. */
+    std::int64_t duration_nanoseconds;
 };
 
+/** @brief The common case: a timer driven by the wall steady clock. */
+using Timer = BasicTimer<std::chrono::steady_clock>;
+
+// timers must stay trivially copyable and destructible so arrays of them can be bulk-initialized,
+// memcpy'd and placement-new'd into arenas without per-element bookkeeping
+static_assert(std::is_trivially_copyable<Timer>::value, "Timer must be trivially copyable");
+static_assert(std::is_trivially_destructible<Timer>::value, "Timer must be trivially destructible");
+// 16 bytes = 4 timers per cache line; a third of the old 24-byte layout's scan bandwidth was
+// padding, so this must not silently regress
+static_assert(sizeof(Timer) == 16, "Timer must stay 16 bytes for contiguous batch polling");
+
+/**
+ * @brief Start (or restart) a contiguous batch of timers off a single clock sample.
+ *
+ * Starting a wave of timers one by one costs one clock read each; this samples the clock once
+ * and starts every timer relative to the same time point. Beyond the saved clock calls, the
+ * shared timestamp means the whole cohort expires in a deterministic order.
+ */
+template <typename Clock, typename Stats> inline void start_all(BasicTimer<Clock, Stats> *timers, std::size_t count) {
+    start_all(timers, count, Clock::now());
+}
+
+/**
+ * @brief Cached-clock version of start_all().
+ *
+ * @param now A time point sampled from the timers' clock by the caller.
+ */
+template <typename Clock, typename Stats>
+inline void start_all(BasicTimer<Clock, Stats> *timers, std::size_t count, typename BasicTimer<Clock, Stats>::time_point now) {
+    for (std::size_t i = 0; i < count; i++) {
+        timers[i].start(now);
+    }
+}
+
+/**
+ * @brief Rescale a contiguous batch of timers off a single clock sample.
+ *
+ * Every timer's duration and remaining time scale by `factor` with percent-complete preserved
+ * (@see BasicTimer::rescale), and the shared sample means the whole cohort rescales at exactly
+ * the same instant — one clock read for any number of timers.
+ */
+template <typename Clock, typename Stats>
+inline void rescale_all(BasicTimer<Clock, Stats> *timers, std::size_t count, double factor) {
+    rescale_all(timers, count, factor, Clock::now());
+}
+
+/**
+ * @brief Cached-clock version of rescale_all().
+ *
+ * @param now A time point sampled from the timers' clock by the caller.
+ */
+template <typename Clock, typename Stats>
+inline void rescale_all(BasicTimer<Clock, Stats> *timers, std::size_t count, double factor,
+                        typename BasicTimer<Clock, Stats>::time_point now) {
+    for (std::size_t i = 0; i < count; i++) {
+        timers[i].rescale(factor, now);
+    }
+}
+
+/**
+ * @brief Run time_up_and_try_to_restart() over a contiguous batch of timers off a single clock sample.
+ *
+ * Every expired timer in the batch restarts relative to the same time point, so restarted
+ * cohorts stay in lockstep instead of spreading out by per-call clock skew.
+ *
+ * @return The number of timers that had expired (and were restarted).
+ */
+template <typename Clock, typename Stats> inline std::size_t time_up_and_try_to_restart_all(BasicTimer<Clock, Stats> *timers, std::size_t count) {
+    return time_up_and_try_to_restart_all(timers, count, Clock::now());
+}
+
+/**
+ * @brief Cached-clock version of time_up_and_try_to_restart_all().
+ *
+ * @param now A time point sampled from the timers' clock by the caller.
+ */
+template <typename Clock, typename Stats>
+inline std::size_t time_up_and_try_to_restart_all(BasicTimer<Clock, Stats> *timers, std::size_t count,
+                                                  typename BasicTimer<Clock, Stats>::time_point now) {
+    std::size_t restarted = 0;
+    for (std::size_t i = 0; i < count; i++) {
+        if (timers[i].time_up_and_try_to_restart(now))
+            restarted++;
+    }
+    return restarted;
+}
+
+// The method bodies live below the class (all inline, since the class is a template) so polling
+// loops can inline them without LTO: the compiler can then hoist the clock read out of a loop and
+// fold time_up() down to a load and an integer compare.
+
+template <typename Clock, typename Stats> inline void BasicTimer<Clock, Stats>::start() { start(Clock::now()); }
+
+template <typename Clock, typename Stats> inline void BasicTimer<Clock, Stats>::start(time_point now) {
+    deadline_nanoseconds = to_nanoseconds(now) + duration_nanoseconds;
+    if constexpr (Stats::enabled)
+        this->overshoot_recorded = false; // the next expiry is a fresh one
+}
+
+template <typename Clock, typename Stats> inline bool BasicTimer<Clock, Stats>::time_up() const { return time_up(Clock::now()); }
+
+template <typename Clock, typename Stats> inline bool BasicTimer<Clock, Stats>::time_up(time_point now) const {
+    if (deadline_nanoseconds < 0)
+        // not the hot case: never started (false) or paused (frozen remaining time decides)
+        return deadline_nanoseconds != not_started && ~deadline_nanoseconds <= 0;
+    bool expired = to_nanoseconds(now) >= deadline_nanoseconds;
+    if constexpr (Stats::enabled) {
+        // overshoot is only meaningful the first time an expiry is observed
+        bool first_expiry = expired && !this->overshoot_recorded;
+        Stats::record_poll(expired, first_expiry ? to_nanoseconds(now) - deadline_nanoseconds : -1);
+        if (first_expiry)
+            this->overshoot_recorded = true;
+    }
+    return expired;
+}
+
+template <typename Clock, typename Stats> inline bool BasicTimer<Clock, Stats>::time_up_and_try_to_restart() {
+    return time_up_and_try_to_restart(Clock::now());
+}
+
+template <typename Clock, typename Stats> inline bool BasicTimer<Clock, Stats>::time_up_and_try_to_restart(time_point now) {
+    bool time_is_up = time_up(now);
+    if (time_is_up) {
+        start(now);
+    }
+    return time_is_up;
+}
+
+template <typename Clock, typename Stats> inline bool BasicTimer<Clock, Stats>::time_up_and_restart_periodic(MissedPeriodPolicy policy) {
+    return time_up_and_restart_periodic(Clock::now(), policy);
+}
+
+template <typename Clock, typename Stats>
+inline bool BasicTimer<Clock, Stats>::time_up_and_restart_periodic(time_point now, MissedPeriodPolicy policy) {
+    if (!is_running_state() || !time_up(now))
+        return false; // paused timers stay frozen; resume() them before firing periods again
+    if (policy == MissedPeriodPolicy::fire_once_per_missed_period) {
+        deadline_nanoseconds += duration_nanoseconds;
+        return true;
+    }
+    // skip missed periods: land on the first period boundary strictly after now
+    std::int64_t periods_behind = (to_nanoseconds(now) - deadline_nanoseconds) / duration_nanoseconds;
+    deadline_nanoseconds += (periods_behind + 1) * duration_nanoseconds;
+    return true;
+}
+
+template <typename Clock, typename Stats> inline double BasicTimer<Clock, Stats>::get_remaining_time() const {
+    return get_remaining_time(Clock::now());
+}
+
+template <typename Clock, typename Stats> inline double BasicTimer<Clock, Stats>::get_remaining_time(time_point now) const {
+    if (deadline_nanoseconds == not_started)
+        return static_cast<double>(duration_nanoseconds) *
+               1e-9; // return the full duration, because the timer hasn't started yet.
+    std::int64_t remaining =
+        deadline_nanoseconds < 0 ? ~deadline_nanoseconds : deadline_nanoseconds - to_nanoseconds(now);
+    return remaining > 0 ? static_cast<double>(remaining) * 1e-9 : 0.0; // return zero if we've gone over budget
+}
+
+template <typename Clock, typename Stats> inline void BasicTimer<Clock, Stats>::change_duration(double duration_seconds) {
+    std::int64_t new_duration = static_cast<std::int64_t>(duration_seconds * 1e9);
+    if (new_duration <= 0)
+        return; // duration must stay at least one nanosecond
+    if (is_running_state()) {
+        // keep the original start time: shift the deadline by the change in duration
+        deadline_nanoseconds += new_duration - duration_nanoseconds;
+    } else if (is_paused_state()) {
+        std::int64_t remaining = ~deadline_nanoseconds + (new_duration - duration_nanoseconds);
+        deadline_nanoseconds = ~(remaining > 0 ? remaining : 0);
+    }
+    duration_nanoseconds = new_duration;
+}
+
+template <typename Clock, typename Stats> inline void BasicTimer<Clock, Stats>::rescale(double factor) {
+    rescale(factor, Clock::now());
+}
+
+template <typename Clock, typename Stats> inline void BasicTimer<Clock, Stats>::rescale(double factor, time_point now) {
+    if (factor <= 0.0)
+        return; // the duration must stay strictly positive
+    if (is_running_state()) {
+        // scaling the remaining time by the same factor as the duration keeps
+        // elapsed/duration — the completion fraction — unchanged
+        std::int64_t remaining = deadline_nanoseconds - to_nanoseconds(now);
+        std::int64_t scaled_deadline =
+            to_nanoseconds(now) + static_cast<std::int64_t>(static_cast<double>(remaining) * factor);
+        // an expired timer scaled near a small-epoch clock's origin must not leave the
+        // running-deadline encoding
+        deadline_nanoseconds = scaled_deadline > 0 ? scaled_deadline : 0;
+    } else if (is_paused_state()) {
+        std::int64_t remaining = static_cast<std::int64_t>(static_cast<double>(~deadline_nanoseconds) * factor);
+        deadline_nanoseconds = ~(remaining > 0 ? remaining : 0);
+    }
+    std::int64_t scaled_duration = static_cast<std::int64_t>(static_cast<double>(duration_nanoseconds) * factor);
+    // a tiny factor can truncate the scaled duration to zero; keep the ≥ 1ns invariant the
+    // constructors enforce so the division paths stay safe
+    duration_nanoseconds = scaled_duration > 0 ? scaled_duration : 1;
+}
+
+template <typename Clock, typename Stats> inline void BasicTimer<Clock, Stats>::pause() { pause(Clock::now()); }
+
+template <typename Clock, typename Stats> inline void BasicTimer<Clock, Stats>::pause(time_point now) {
+    if (!is_running_state())
+        return;
+    // encode the frozen remaining nanoseconds (clamped at zero: expired stays expired) into
+    // the deadline word, bitwise-complemented so the value is negative
+    std::int64_t remaining = deadline_nanoseconds - to_nanoseconds(now);
+    deadline_nanoseconds = ~(remaining > 0 ? remaining : 0);
+}
+
+template <typename Clock, typename Stats> inline void BasicTimer<Clock, Stats>::resume() { resume(Clock::now()); }
+
+template <typename Clock, typename Stats> inline void BasicTimer<Clock, Stats>::resume(time_point now) {
+    if (!is_paused_state())
+        return;
+    deadline_nanoseconds = to_nanoseconds(now) + ~deadline_nanoseconds;
+}
+
+template <typename Clock, typename Stats> inline bool BasicTimer<Clock, Stats>::is_paused() const { return is_paused_state(); }
+
+template <typename Clock, typename Stats> inline bool BasicTimer<Clock, Stats>::is_running() const { return is_running_state(); }
+
+template <typename Clock, typename Stats> inline double BasicTimer<Clock, Stats>::get_percent_complete() const {
+    return get_percent_complete(Clock::now());
+}
+
+template <typename Clock, typename Stats> inline double BasicTimer<Clock, Stats>::get_percent_complete(time_point now) const {
+    if (deadline_nanoseconds == not_started)
+        return 0.0;
+    std::int64_t elapsed = deadline_nanoseconds < 0
+                               ? duration_nanoseconds - ~deadline_nanoseconds
+                               : to_nanoseconds(now) - (deadline_nanoseconds - duration_nanoseconds);
+    double progress = static_cast<double>(elapsed) / static_cast<double>(duration_nanoseconds);
+    return progress < 1.0 ? progress : 1.0;
+}
+
+template <typename Clock, typename Stats>
+inline BasicTimer<Clock, Stats> BasicTimer<Clock, Stats>::derive_child(double margin_seconds) const noexcept {
+    BasicTimer child(timer_unchecked, 1.0);
+    std::int64_t margin = static_cast<std::int64_t>(margin_seconds * 1e9);
+    std::int64_t child_duration = duration_nanoseconds - margin;
+    child.duration_nanoseconds = child_duration > 0 ? child_duration : 1;
+    if (is_running_state()) {
+        std::int64_t child_deadline = deadline_nanoseconds - margin; // the one-integer-copy derivation
+        child.deadline_nanoseconds = child_deadline > 0 ? child_deadline : 0;
+    } else if (is_paused_state()) {
+        std::int64_t child_remaining = ~deadline_nanoseconds - margin;
+        child.deadline_nanoseconds = ~(child_remaining > 0 ? child_remaining : 0);
+    } else {
+        child.deadline_nanoseconds = not_started;
+    }
+    return child;
+}
+
+template <typename Clock, typename Stats> inline TimerSnapshot BasicTimer<Clock, Stats>::save() const { return save(Clock::now()); }
+
+template <typename Clock, typename Stats> inline TimerSnapshot BasicTimer<Clock, Stats>::save(time_point now) const {
+    TimerSnapshot snapshot{};
+    snapshot.duration_nanoseconds = duration_nanoseconds;
+    if (deadline_nanoseconds != not_started) {
+        snapshot.flags = TimerSnapshot::flag_running;
+        std::int64_t remaining =
+            deadline_nanoseconds < 0 ? ~deadline_nanoseconds : deadline_nanoseconds - to_nanoseconds(now);
+        snapshot.remaining_nanoseconds = remaining > 0 ? remaining : 0;
+        if (deadline_nanoseconds < 0)
+            snapshot.flags |= TimerSnapshot::flag_paused;
+    }
+    return snapshot;
+}
+
+template <typename Clock, typename Stats> inline BasicTimer<Clock, Stats> BasicTimer<Clock, Stats>::restore(const TimerSnapshot &snapshot) {
+    return restore(snapshot, Clock::now());
+}
+
+template <typename Clock, typename Stats>
+inline BasicTimer<Clock, Stats> BasicTimer<Clock, Stats>::restore(const TimerSnapshot &snapshot, time_point now) {
+    BasicTimer timer(timer_unchecked, 1.0);
+    timer.duration_nanoseconds = snapshot.duration_nanoseconds;
+    if ((snapshot.flags & TimerSnapshot::flag_paused) != 0) {
+        std::int64_t remaining = snapshot.remaining_nanoseconds;
+        timer.deadline_nanoseconds = ~(remaining > 0 ? remaining : 0); // frozen remaining time
+    } else if ((snapshot.flags & TimerSnapshot::flag_running) != 0) {
+        timer.deadline_nanoseconds = to_nanoseconds(now) + snapshot.remaining_nanoseconds;
+    } else {
+        timer.deadline_nanoseconds = not_started;
+    }
+    return timer;
+}
+
+/**
+ * @brief Snapshot a contiguous array of timers into a caller-provided record array.
+ *
+ * One clock read for the whole batch and no allocation; `snapshots_out` must hold `count`
+ * records.
+ */
+template <typename Clock, typename Stats>
+inline void save_all(const BasicTimer<Clock, Stats> *timers, std::size_t count, TimerSnapshot *snapshots_out) {
+    auto now = Clock::now();
+    for (std::size_t i = 0; i < count; i++) {
+        snapshots_out[i] = timers[i].save(now);
+    }
+}
+
+/**
+ * @brief Rebuild a contiguous array of timers from snapshot records.
+ *
+ * One clock read for the whole batch, so every restored timer resumes relative to the same
+ * instant; `timers_out` must hold `count` timers.
+ */
+template <typename Clock, typename Stats>
+inline void restore_all(const TimerSnapshot *snapshots, std::size_t count, BasicTimer<Clock, Stats> *timers_out) {
+    auto now = Clock::now();
+    for (std::size_t i = 0; i < count; i++) {
+        timers_out[i] = BasicTimer<Clock, Stats>::restore(snapshots[i], now);
+    }
+}
+
+template <typename Clock, typename Stats> inline std::int64_t BasicTimer<Clock, Stats>::to_nanoseconds(time_point time_point_value) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point_value.time_since_epoch()).count();
+}
+
 #endif // TIMER_HPP
@@ -0,0 +1,79 @@
+#ifndef TIMER_AWAITABLE_HPP
+#define TIMER_AWAITABLE_HPP
+
+#include "timer.hpp"
+#include "timer_scheduler.hpp"
+
+// the awaitable needs C++20 coroutines; on older standards this header is inert so it can stay
+// in the subproject's exports without breaking C++17 consumers
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+
+/**
+ * @class TimerAwaitable
+ * @brief Lets a coroutine co_await a delay (or a Timer's expiry) without polling.
+ *
+ * Awaiting suspends the coroutine and registers a one-shot task on a TimerScheduler; when the
+ * deadline passes, the scheduler's dispatcher resumes the coroutine. Thousands of coroutines can
+ * therefore sleep on timers with a single dispatcher thread and zero polling loops.
+ *
+ * The coroutine resumes on the scheduler's dispatcher thread; hop back onto your own executor
+ * after the co_await if that matters, and keep the scheduler alive until every awaiting
+ * coroutine has resumed.
+ *
+ * Example usage:
+ * @code
+ * task<void> session_watchdog(TimerScheduler &scheduler, Timer &idle) {
+ *     co_await expiry(scheduler, idle);      // no polling loop, no burned core
+ *     co_await expire_after(scheduler, 1.0); // grace period
+ *     close_session();
+ * }
+ * @endcode
+ */
+class TimerAwaitable {
+  public:
+    /**
+     * @brief Build an awaitable that resumes after `delay_seconds` on `scheduler`'s dispatcher.
+     */
+    TimerAwaitable(TimerScheduler &scheduler, double delay_seconds)
+        : scheduler(scheduler), delay_seconds(delay_seconds) {}
+
+    /** @brief Already-expired delays complete without suspending. */
+    bool await_ready() const noexcept { return delay_seconds <= 0.0; }
+
+    /** @brief Suspend and let the scheduler resume the coroutine when the delay elapses. */
+    void await_suspend(std::coroutine_handle<> handle) {
+        scheduler.schedule(delay_seconds, [handle] { handle.resume(); });
+    }
+
+    /** @brief Expiry carries no value. */
+    void await_resume() const noexcept {}
+
+  private:
+    /** @brief The scheduler whose dispatcher thread performs the wakeup. */
+    TimerScheduler &scheduler;
+
+    /** @brief How long to suspend, in seconds. */
+    double delay_seconds;
+};
+
+/**
+ * @brief Awaitable that completes after `delay_seconds`.
+ */
+inline TimerAwaitable expire_after(TimerScheduler &scheduler, double delay_seconds) {
+    return TimerAwaitable(scheduler, delay_seconds);
+}
+
+/**
+ * @brief Awaitable that completes when `timer` expires (based on its remaining time now).
+ *
+ * Costs one clock read to sample the remaining time; a timer that has not been started waits
+ * its full duration, matching Timer::get_remaining_time().
+ */
+inline TimerAwaitable expiry(TimerScheduler &scheduler, const Timer &timer) {
+    return TimerAwaitable(scheduler, timer.get_remaining_time());
+}
+
+#endif // __cpp_impl_coroutine
+
+#endif // TIMER_AWAITABLE_HPP
@@ -0,0 +1,65 @@
+#include "timer_batch.hpp"
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+// builds one 64-bit mask word from up to 64 deadlines starting at `deadlines`
+std::uint64_t mask_word(const std::int64_t *deadlines, std::size_t n, std::int64_t now_nanoseconds) {
+    std::uint64_t word = 0;
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    __m256i now_vec = _mm256_set1_epi64x(now_nanoseconds);
+    for (; i + 4 <= n; i += 4) {
+        __m256i deadline_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(deadlines + i));
+        // deadline <= now  <=>  !(deadline > now)
+        __m256i not_expired = _mm256_cmpgt_epi64(deadline_vec, now_vec);
+        std::uint64_t bits = static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(not_expired)));
+        word |= (~bits & 0xF) << i;
+    }
+#elif defined(__SSE4_2__)
+    __m128i now_vec = _mm_set1_epi64x(now_nanoseconds);
+    for (; i + 2 <= n; i += 2) {
+        __m128i deadline_vec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(deadlines + i));
+        __m128i not_expired = _mm_cmpgt_epi64(deadline_vec, now_vec);
+        std::uint64_t bits = static_cast<std::uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(not_expired)));
+        word |= (~bits & 0x3) << i;
+    }
+#elif defined(__aarch64__)
+    int64x2_t now_vec = vdupq_n_s64(now_nanoseconds);
+    for (; i + 2 <= n; i += 2) {
+        int64x2_t deadline_vec = vld1q_s64(deadlines + i);
+        uint64x2_t expired = vcleq_s64(deadline_vec, now_vec);
+        word |= (vgetq_lane_u64(expired, 0) & 1) << i;
+        word |= (vgetq_lane_u64(expired, 1) & 1) << (i + 1);
+    }
+#endif
+    for (; i < n; i++) {
+        word |= static_cast<std::uint64_t>(deadlines[i] <= now_nanoseconds) << i;
+    }
+    return word;
+}
+
+} // namespace
+
+void batch_time_up(const std::int64_t *deadlines, std::size_t n, std::int64_t now_nanoseconds,
+                   std::uint64_t *out_mask) {
+    std::size_t word_index = 0;
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        out_mask[word_index++] = mask_word(deadlines + i, 64, now_nanoseconds);
+    }
+    if (i < n) {
+        out_mask[word_index] = mask_word(deadlines + i, n - i, now_nanoseconds);
+    }
+}
+
+void batch_time_up(const std::int64_t *deadlines, std::size_t n, std::chrono::steady_clock::time_point now,
+                   std::uint64_t *out_mask) {
+    batch_time_up(deadlines, n,
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count(), out_mask);
+}
@@ -0,0 +1,47 @@
+#ifndef TIMER_BATCH_HPP
+#define TIMER_BATCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file timer_batch.hpp
+ * @brief Vectorized batch expiry check over contiguous deadline arrays.
+ *
+ * Given an array of absolute deadlines (nanoseconds since the steady_clock epoch, as stored by
+ * TimerPool) and a single `now`, batch_time_up() writes one bit per deadline into an output
+ * bitmask: bit `i` of `out_mask[i / 64]` is set when `deadlines[i] <= now`. The comparison loop
+ * is branch-free and compiled with SIMD compare-and-movemask (AVX2 or SSE4.2 on x86, NEON on
+ * AArch64, with a scalar fallback elsewhere), retiring several timers per cycle instead of one
+ * compare-and-branch each.
+ *
+ * Stopped timers should hold a sentinel deadline of INT64_MAX (as TimerPool does) so they never
+ * report expired.
+ */
+
+/**
+ * @brief Compute the number of 64-bit mask words needed for `n` deadlines.
+ */
+constexpr std::size_t batch_mask_words(std::size_t n) { return (n + 63) / 64; }
+
+/**
+ * @brief Compare `n` deadlines against `now_nanoseconds` and write the results as a bitmask.
+ *
+ * @param deadlines Contiguous array of absolute deadlines in nanoseconds since the steady_clock
+ *        epoch.
+ * @param n The number of deadlines.
+ * @param now_nanoseconds The single time sample to compare every deadline against.
+ * @param out_mask Output array of at least batch_mask_words(n) words. Bit `i % 64` of word
+ *        `i / 64` is set when deadline `i` has passed; bits past `n` are cleared.
+ */
+void batch_time_up(const std::int64_t *deadlines, std::size_t n, std::int64_t now_nanoseconds,
+                   std::uint64_t *out_mask);
+
+/**
+ * @brief Convenience overload taking a steady_clock time point instead of raw nanoseconds.
+ */
+void batch_time_up(const std::int64_t *deadlines, std::size_t n, std::chrono::steady_clock::time_point now,
+                   std::uint64_t *out_mask);
+
+#endif // TIMER_BATCH_HPP
@@ -0,0 +1,46 @@
+#include "timer_group.hpp"
+
+#include <stdexcept>
+
+TimerGroup::TimerGroup(double time_scale)
+    : last_real_time(std::chrono::steady_clock::now()),
+      virtual_nanoseconds(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(last_real_time.time_since_epoch()).count()),
+      time_scale(time_scale) {
+    if (time_scale < 0.0) {
+        throw std::invalid_argument("TimerGroup time scale must not be negative");
+    }
+}
+
+void TimerGroup::set_time_scale(double new_time_scale) {
+    if (new_time_scale < 0.0)
+        return; // virtual time must not run backwards
+    // bank everything elapsed so far at the old scale; only the future runs at the new one
+    catch_up(std::chrono::steady_clock::now());
+    time_scale = new_time_scale;
+}
+
+double TimerGroup::get_time_scale() const { return time_scale; }
+
+std::chrono::steady_clock::time_point TimerGroup::now() const {
+    catch_up(std::chrono::steady_clock::now());
+    return std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::nanoseconds(virtual_nanoseconds)));
+}
+
+void TimerGroup::start(Timer &timer) const { timer.start(now()); }
+
+bool TimerGroup::time_up(const Timer &timer) const { return timer.time_up(now()); }
+
+bool TimerGroup::time_up_and_try_to_restart(Timer &timer) const { return timer.time_up_and_try_to_restart(now()); }
+
+double TimerGroup::get_remaining_time(const Timer &timer) const { return timer.get_remaining_time(now()); }
+
+double TimerGroup::get_percent_complete(const Timer &timer) const { return timer.get_percent_complete(now()); }
+
+void TimerGroup::catch_up(std::chrono::steady_clock::time_point real_now) const {
+    std::int64_t real_elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(real_now - last_real_time).count();
+    virtual_nanoseconds += static_cast<std::int64_t>(static_cast<double>(real_elapsed) * time_scale);
+    last_real_time = real_now;
+}
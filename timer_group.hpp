@@ -0,0 +1,107 @@
+#ifndef TIMER_GROUP_HPP
+#define TIMER_GROUP_HPP
+
+#include "timer.hpp"
+
+#include <chrono>
+
+/**
+ * @class TimerGroup
+ * @brief A shared, scalable time source so many timers can be slowed down or sped up at once.
+ *
+ * Rescaling thousands of timers by looping over change_duration() is O(n) per scale change and
+ * produces the non-monotonic percent-complete glitches that change_duration() documents. A
+ * TimerGroup instead owns a virtual clock that advances at `time_scale` times real speed; the
+ * scale is applied when time is sampled, so set_time_scale() is O(1) no matter how many timers
+ * follow the group, and get_percent_complete() stays monotone across scale changes (virtual
+ * time never goes backwards for non-negative scales).
+ *
+ * Timers don't store a reference to their group; they simply get started and queried with the
+ * group's time, either through the passthrough helpers below or by sampling group.now() once
+ * per tick and passing it to the cached-clock overloads.
+ *
+ * Example usage:
+ * @code
+ * TimerGroup zone_time;
+ * Timer respawn(30.0);
+ * zone_time.start(respawn);
+ *
+ * zone_time.set_time_scale(0.5); // slow motion: every timer in the zone halves, O(1)
+ *
+ * auto now = zone_time.now();    // one sample per tick
+ * for (auto &t : zone_timers)
+ *     if (t.time_up(now))
+ *         handle_expiry(t);
+ * @endcode
+ */
+class TimerGroup {
+  public:
+    /**
+     * @brief Construct a group whose virtual clock starts at the current real time.
+     *
+     * @param time_scale The initial rate of virtual time relative to real time. 1.0 is real
+     *        time, 0.5 is half speed, 2.0 is double speed, 0.0 freezes the group.
+     */
+    explicit TimerGroup(double time_scale = 1.0);
+
+    /**
+     * @brief Change the rate of virtual time. O(1) regardless of how many timers use the group.
+     *
+     * Time already elapsed is folded in at the old scale first, so the change only affects the
+     * future. Negative scales are ignored (virtual time must not run backwards).
+     */
+    void set_time_scale(double time_scale);
+
+    /**
+     * @brief The current rate of virtual time relative to real time.
+     */
+    double get_time_scale() const;
+
+    /**
+     * @brief Sample the group's virtual time.
+     *
+     * Pass the result to the cached-clock overloads of Timer (and to start()) to run timers on
+     * group time; sample once per tick to amortize the single real clock read underneath.
+     */
+    std::chrono::steady_clock::time_point now() const;
+
+    /**
+     * @brief Start a timer on group time.
+     */
+    void start(Timer &timer) const;
+
+    /**
+     * @brief Check a timer for expiry against group time.
+     */
+    bool time_up(const Timer &timer) const;
+
+    /**
+     * @brief Timer::time_up_and_try_to_restart() against group time.
+     */
+    bool time_up_and_try_to_restart(Timer &timer) const;
+
+    /**
+     * @brief Timer::get_remaining_time() against group time (in virtual seconds).
+     */
+    double get_remaining_time(const Timer &timer) const;
+
+    /**
+     * @brief Timer::get_percent_complete() against group time.
+     */
+    double get_percent_complete(const Timer &timer) const;
+
+  private:
+    /** @brief Fold real time elapsed since the last sample into the virtual clock at the current scale. */
+    void catch_up(std::chrono::steady_clock::time_point real_now) const;
+
+    /** @brief The real time point the virtual clock was last advanced to. */
+    mutable std::chrono::steady_clock::time_point last_real_time;
+
+    /** @brief Virtual nanoseconds accumulated so far (on the steady_clock epoch). */
+    mutable std::int64_t virtual_nanoseconds;
+
+    /** @brief The rate of virtual time relative to real time. */
+    double time_scale;
+};
+
+#endif // TIMER_GROUP_HPP
@@ -0,0 +1,147 @@
+#include "timer_pool.hpp"
+#include "timer_batch.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+TimerPool::Handle TimerPool::create(double duration_seconds, bool start_immediately) {
+    std::int64_t duration_nanoseconds = static_cast<std::int64_t>(duration_seconds * 1e9);
+    if (duration_nanoseconds <= 0) {
+        // a positive duration below 1ns truncates to zero; validate the converted count
+        throw std::invalid_argument("TimerPool duration must be at least one nanosecond");
+    }
+    Handle handle;
+    if (free_head != no_free_slot) {
+        // steady state: pop a recycled slot, no allocation
+        handle.index = free_head;
+        free_head = static_cast<std::uint32_t>(durations[free_head]);
+        durations[handle.index] = duration_nanoseconds;
+    } else {
+        handle.index = static_cast<std::uint32_t>(deadlines.size());
+        deadlines.push_back(never);
+        durations.push_back(duration_nanoseconds);
+        running.push_back(false);
+        generations.push_back(0);
+    }
+    handle.generation = generations[handle.index];
+    live_count++;
+    if (start_immediately) {
+        start(handle);
+    }
+    return handle;
+}
+
+void TimerPool::destroy(Handle handle) {
+    check(handle);
+    deadlines[handle.index] = never;
+    running[handle.index] = false;
+    generations[handle.index]++; // every outstanding handle to this slot goes stale
+    durations[handle.index] = free_head;
+    free_head = handle.index;
+    live_count--;
+}
+
+void TimerPool::reserve(std::size_t expected_timers) {
+    deadlines.reserve(expected_timers);
+    durations.reserve(expected_timers);
+    running.reserve(expected_timers);
+    generations.reserve(expected_timers);
+}
+
+bool TimerPool::is_valid(Handle handle) const {
+    return handle.index < generations.size() && generations[handle.index] == handle.generation;
+}
+
+void TimerPool::check(Handle handle) const {
+    assert(is_valid(handle) && "stale TimerPool handle (slot destroyed or recycled)");
+    (void)handle;
+}
+
+void TimerPool::start(Handle handle) { start(handle, std::chrono::steady_clock::now()); }
+
+void TimerPool::start(Handle handle, std::chrono::steady_clock::time_point now) {
+    check(handle);
+    deadlines[handle.index] = to_nanoseconds(now) + durations[handle.index];
+    running[handle.index] = true;
+}
+
+void TimerPool::stop(Handle handle) {
+    check(handle);
+    deadlines[handle.index] = never;
+    running[handle.index] = false;
+}
+
+bool TimerPool::time_up(Handle handle) const { return time_up(handle, std::chrono::steady_clock::now()); }
+
+bool TimerPool::time_up(Handle handle, std::chrono::steady_clock::time_point now) const {
+    check(handle);
+    return deadlines[handle.index] <= to_nanoseconds(now); // stopped timers hold `never` and can't match
+}
+
+double TimerPool::get_remaining_time(Handle handle) const {
+    return get_remaining_time(handle, std::chrono::steady_clock::now());
+}
+
+double TimerPool::get_remaining_time(Handle handle, std::chrono::steady_clock::time_point now) const {
+    check(handle);
+    if (!running[handle.index])
+        return static_cast<double>(durations[handle.index]) * 1e-9;
+    std::int64_t remaining = deadlines[handle.index] - to_nanoseconds(now);
+    return remaining > 0 ? static_cast<double>(remaining) * 1e-9 : 0.0;
+}
+
+void TimerPool::change_duration(Handle handle, double duration_seconds) {
+    check(handle);
+    std::int64_t new_duration = static_cast<std::int64_t>(duration_seconds * 1e9);
+    if (new_duration <= 0)
+        return; // duration must stay at least one nanosecond
+    if (running[handle.index]) {
+        // keep the original start time, as Timer::change_duration does
+        deadlines[handle.index] += new_duration - durations[handle.index];
+    }
+    durations[handle.index] = new_duration;
+}
+
+void TimerPool::poll_expired(std::vector<std::uint32_t> &out_indices) const {
+    poll_expired(std::chrono::steady_clock::now(), out_indices);
+}
+
+void TimerPool::poll_expired(std::chrono::steady_clock::time_point now,
+                             std::vector<std::uint32_t> &out_indices) const {
+    out_indices.clear();
+    std::int64_t now_ns = to_nanoseconds(now);
+    const std::int64_t *deadline_data = deadlines.data();
+    std::size_t n = deadlines.size();
+    for (std::size_t i = 0; i < n; i++) {
+        if (deadline_data[i] <= now_ns) {
+            out_indices.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+}
+
+void TimerPool::poll_expired_mask(std::vector<std::uint64_t> &out_mask) const {
+    poll_expired_mask(std::chrono::steady_clock::now(), out_mask);
+}
+
+void TimerPool::poll_expired_mask(std::chrono::steady_clock::time_point now,
+                                  std::vector<std::uint64_t> &out_mask) const {
+    out_mask.resize(batch_mask_words(deadlines.size()));
+    batch_time_up(deadlines.data(), deadlines.size(), to_nanoseconds(now), out_mask.data());
+}
+
+std::optional<std::chrono::steady_clock::time_point> TimerPool::next_deadline() const {
+    std::int64_t soonest = never;
+    for (std::int64_t deadline : deadlines) {
+        soonest = deadline < soonest ? deadline : soonest;
+    }
+    if (soonest == never)
+        return std::nullopt;
+    return std::chrono::steady_clock::time_point(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(soonest)));
+}
+
+std::size_t TimerPool::size() const { return live_count; }
+
+std::int64_t TimerPool::to_nanoseconds(std::chrono::steady_clock::time_point time_point) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point.time_since_epoch()).count();
+}
@@ -0,0 +1,199 @@
+#ifndef TIMER_POOL_HPP
+#define TIMER_POOL_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @class TimerPool
+ * @brief Owns a large number of timers in struct-of-arrays layout for cache-friendly batch polling.
+ *
+ * Scanning a `std::vector<Timer>` pulls every timer's full object through the cache even though
+ * batch polling only needs the deadline. A TimerPool stores all deadlines in one contiguous
+ * array (with durations and run-state kept in parallel arrays), so poll_expired() is a linear
+ * walk over tightly packed 8-byte deadlines — the layout the hardware prefetcher and the
+ * compiler's vectorizer both want.
+ *
+ * Timers are addressed through lightweight handles returned by create(). A handle stays valid
+ * until its timer is destroy()ed; destroyed slots are recycled through a free list, so
+ * steady-state create/destroy churn never touches the allocator.
+ *
+ * Example usage:
+ * @code
+ * TimerPool pool;
+ * std::vector<TimerPool::Handle> sessions;
+ * for (int i = 0; i < 40000; i++)
+ *     sessions.push_back(pool.create(30.0, true));
+ *
+ * std::vector<std::uint32_t> expired;
+ * pool.poll_expired(expired); // one clock read, one linear scan
+ * for (std::uint32_t index : expired)
+ *     handle_idle_session(index);
+ * @endcode
+ */
+class TimerPool {
+  public:
+    /**
+     * @brief A lightweight reference to a timer owned by the pool.
+     *
+     * Handles carry a generation tag: destroying a timer bumps its slot's generation, so a stale
+     * handle held past destroy() is detectable via is_valid() and trips an assert in debug
+     * builds instead of silently addressing whatever timer recycled the slot.
+     */
+    struct Handle {
+        std::uint32_t index;
+        std::uint32_t generation;
+    };
+
+    /**
+     * @brief Create a new timer in the pool, recycling a destroyed slot when one is free.
+     *
+     * On the steady state path (destroys roughly balancing creates) this is a free-list pop with
+     * zero allocation; the arrays only grow when the pool is at peak occupancy.
+     *
+     * @param duration_seconds The duration of the timer in seconds.
+     * @param start_immediately If true, the timer starts immediately upon creation.
+     * @return A handle addressing the new timer.
+     */
+    Handle create(double duration_seconds, bool start_immediately = false);
+
+    /**
+     * @brief Return a timer's slot to the pool for recycling.
+     *
+     * The slot joins an intrusive free list (threaded through the unused duration entries, so no
+     * extra storage) and its generation is bumped, invalidating every outstanding handle to it.
+     */
+    void destroy(Handle handle);
+
+    /**
+     * @brief Pre-size the pool's arrays for `expected_timers` so creation never reallocates.
+     */
+    void reserve(std::size_t expected_timers);
+
+    /**
+     * @brief Whether `handle` still addresses the timer it was created for.
+     */
+    bool is_valid(Handle handle) const;
+
+    /**
+     * @brief Start or restart the timer addressed by `handle`.
+     */
+    void start(Handle handle);
+
+    /**
+     * @brief Cached-clock version of start().
+     */
+    void start(Handle handle, std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Stop the timer addressed by `handle` without expiring it.
+     */
+    void stop(Handle handle);
+
+    /**
+     * @brief Check whether the timer addressed by `handle` has expired.
+     */
+    bool time_up(Handle handle) const;
+
+    /**
+     * @brief Cached-clock version of time_up().
+     */
+    bool time_up(Handle handle, std::chrono::steady_clock::time_point now) const;
+
+    /**
+     * @brief Get the remaining time in seconds for the timer addressed by `handle`.
+     *
+     * Mirrors Timer::get_remaining_time(): the full duration before start, zero after expiry.
+     */
+    double get_remaining_time(Handle handle) const;
+
+    /**
+     * @brief Cached-clock version of get_remaining_time().
+     */
+    double get_remaining_time(Handle handle, std::chrono::steady_clock::time_point now) const;
+
+    /**
+     * @brief Change the duration of the timer addressed by `handle`.
+     *
+     * Carries the same caveats as Timer::change_duration() for running timers.
+     */
+    void change_duration(Handle handle, double duration_seconds);
+
+    /**
+     * @brief Collect the indices of every running timer whose deadline has passed.
+     *
+     * @param out_indices Cleared, then filled with the indices of expired timers. The scan is a
+     *        single linear pass over the contiguous deadline array with one clock read total.
+     *
+     * Expired timers stay running (and keep reporting expired) until restarted or stopped.
+     */
+    void poll_expired(std::vector<std::uint32_t> &out_indices) const;
+
+    /**
+     * @brief Cached-clock version of poll_expired().
+     */
+    void poll_expired(std::chrono::steady_clock::time_point now, std::vector<std::uint32_t> &out_indices) const;
+
+    /**
+     * @brief Collect expired timers as a bitmask using the vectorized batch_time_up() kernel.
+     *
+     * @param out_mask Resized to one bit per timer; bit `i % 64` of word `i / 64` is set when
+     *        timer `i` has expired. Cheaper than poll_expired() when many timers expire at once,
+     *        since no index vector is built.
+     */
+    void poll_expired_mask(std::vector<std::uint64_t> &out_mask) const;
+
+    /**
+     * @brief Cached-clock version of poll_expired_mask().
+     */
+    void poll_expired_mask(std::chrono::steady_clock::time_point now, std::vector<std::uint64_t> &out_mask) const;
+
+    /**
+     * @brief The earliest deadline across every running timer in the pool, if any.
+     *
+     * Intended for event loops deciding how long they may sleep. A single linear pass over the
+     * contiguous deadline array with no clock reads — the stopped-timer sentinel compares later
+     * than every real deadline, so the scan is a branch-light min reduction.
+     */
+    std::optional<std::chrono::steady_clock::time_point> next_deadline() const;
+
+    /**
+     * @brief The number of live (not destroyed) timers in the pool.
+     */
+    std::size_t size() const;
+
+  private:
+    /** @brief Deadline sentinel for timers that are not running; compares later than any real deadline. */
+    static constexpr std::int64_t never = INT64_MAX;
+
+    /** @brief Free-list terminator. */
+    static constexpr std::uint32_t no_free_slot = UINT32_MAX;
+
+    /** @brief Assert (debug builds) that a handle is alive and current. */
+    void check(Handle handle) const;
+
+    /** @brief Convert a steady_clock time point to nanoseconds since the clock epoch. */
+    static std::int64_t to_nanoseconds(std::chrono::steady_clock::time_point time_point);
+
+    /** @brief Absolute expiry deadlines in nanoseconds, `never` for stopped timers. */
+    std::vector<std::int64_t> deadlines;
+
+    /** @brief Timer durations in nanoseconds, parallel to `deadlines`. */
+    std::vector<std::int64_t> durations;
+
+    /** @brief Run-state bitset, parallel to `deadlines`. */
+    std::vector<bool> running;
+
+    /** @brief Per-slot generation tags; bumped on destroy so stale handles are detectable. */
+    std::vector<std::uint32_t> generations;
+
+    /** @brief Head of the intrusive free list (threaded through `durations`), or `no_free_slot`. */
+    std::uint32_t free_head = no_free_slot;
+
+    /** @brief The number of live timers (slots minus free-list entries). */
+    std::size_t live_count = 0;
+};
+
+#endif // TIMER_POOL_HPP
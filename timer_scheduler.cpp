@@ -0,0 +1,182 @@
+#include "timer_scheduler.hpp"
+
+#include <stdexcept>
+
+TimerScheduler::TimerScheduler() : TimerScheduler(0) {}
+
+TimerScheduler::TimerScheduler(std::size_t worker_count) : next_id(1), stopping(false) {
+    workers.reserve(worker_count);
+    worker_threads.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; i++) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    // workers before the dispatcher, so the first batch never races pool startup
+    for (std::size_t i = 0; i < worker_count; i++) {
+        worker_threads.emplace_back(&TimerScheduler::work, this, i);
+    }
+    dispatcher = std::thread(&TimerScheduler::run, this);
+}
+
+TimerScheduler::~TimerScheduler() { stop(); }
+
+TimerScheduler::TaskId TimerScheduler::schedule(double delay_seconds, Callback callback) {
+    if (delay_seconds < 0.0) {
+        throw std::invalid_argument("TimerScheduler delay must not be negative");
+    }
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double>(delay_seconds));
+    std::lock_guard<std::mutex> lock(mutex);
+    TaskId id = next_id++;
+    tasks.push(Task{deadline, id, std::chrono::steady_clock::duration::zero(), std::move(callback)});
+    pending.insert(id);
+    wakeup.notify_one(); // the new task may be earlier than what the dispatcher is sleeping on
+    return id;
+}
+
+TimerScheduler::TaskId TimerScheduler::schedule_repeating(double interval_seconds, Callback callback) {
+    if (interval_seconds <= 0.0) {
+        throw std::invalid_argument("TimerScheduler interval must be positive");
+    }
+    auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(interval_seconds));
+    auto deadline = std::chrono::steady_clock::now() + interval;
+    std::lock_guard<std::mutex> lock(mutex);
+    TaskId id = next_id++;
+    tasks.push(Task{deadline, id, interval, std::move(callback)});
+    pending.insert(id);
+    wakeup.notify_one();
+    return id;
+}
+
+bool TimerScheduler::cancel(TaskId id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pending.erase(id) == 0)
+        return false; // never scheduled, already fired (one-shot), or already cancelled
+    cancelled.insert(id); // the dispatcher drops the task (and this entry) when it surfaces
+    return true;
+}
+
+void TimerScheduler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping)
+            return;
+        stopping = true;
+    }
+    wakeup.notify_one();
+    if (dispatcher.joinable())
+        dispatcher.join();
+    {
+        std::lock_guard<std::mutex> lock(work_mutex);
+        workers_stopping = true;
+    }
+    work_ready.notify_all();
+    for (std::thread &worker_thread : worker_threads) {
+        if (worker_thread.joinable())
+            worker_thread.join();
+    }
+}
+
+void TimerScheduler::run() {
+    std::vector<Task> batch;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        if (tasks.empty()) {
+            wakeup.wait(lock, [this] { return stopping || !tasks.empty(); });
+            continue;
+        }
+
+        auto earliest = tasks.top().deadline;
+        auto now = std::chrono::steady_clock::now();
+        if (now < earliest) {
+            // sleep until the earliest deadline or until a new task / stop request arrives
+            wakeup.wait_until(lock, earliest);
+            continue;
+        }
+
+        // drain everything that has expired so one wakeup fires the whole batch
+        batch.clear();
+        while (!tasks.empty() && tasks.top().deadline <= now) {
+            Task task = tasks.top();
+            tasks.pop();
+            if (cancelled.erase(task.id) > 0)
+                continue;
+            if (task.interval != std::chrono::steady_clock::duration::zero()) {
+                // advance from the previous deadline, not from now, so periods don't drift
+                Task next = task;
+                next.deadline += task.interval;
+                tasks.push(std::move(next));
+            } else {
+                pending.erase(task.id); // a one-shot is no longer cancellable once it fires
+            }
+            batch.push_back(std::move(task));
+        }
+
+        lock.unlock(); // fire callbacks without holding the lock
+        if (workers.empty()) {
+            for (Task &task : batch) {
+                task.callback();
+            }
+        } else {
+            dispatch_to_workers(batch);
+        }
+        lock.lock();
+    }
+}
+
+void TimerScheduler::dispatch_to_workers(std::vector<Task> &batch) {
+    for (Task &task : batch) {
+        Worker &worker = *workers[next_worker];
+        next_worker = (next_worker + 1) % workers.size();
+        std::lock_guard<std::mutex> lock(worker.queue_mutex);
+        worker.queue.push_back(std::move(task.callback));
+    }
+    {
+        // publish under work_mutex: a worker that just read pending_callbacks == 0 in the wait
+        // predicate must not be able to block before this update lands, or the batch would sit
+        // in the queues until the next one arrives
+        std::lock_guard<std::mutex> lock(work_mutex);
+        pending_callbacks.fetch_add(batch.size(), std::memory_order_release);
+    }
+    work_ready.notify_all();
+}
+
+bool TimerScheduler::take(std::size_t self, Callback &out) {
+    for (std::size_t offset = 0; offset < workers.size(); offset++) {
+        Worker &worker = *workers[(self + offset) % workers.size()];
+        std::lock_guard<std::mutex> lock(worker.queue_mutex);
+        if (worker.queue.empty())
+            continue;
+        if (offset == 0) {
+            // own queue: pop the front, oldest first
+            out = std::move(worker.queue.front());
+            worker.queue.pop_front();
+        } else {
+            // stealing: take from the back to stay off the owner's end of the deque
+            out = std::move(worker.queue.back());
+            worker.queue.pop_back();
+        }
+        pending_callbacks.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void TimerScheduler::work(std::size_t self) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(work_mutex);
+            work_ready.wait(lock, [this] {
+                return workers_stopping || pending_callbacks.load(std::memory_order_acquire) > 0;
+            });
+        }
+        Callback callback;
+        while (take(self, callback)) {
+            callback();
+        }
+        std::lock_guard<std::mutex> lock(work_mutex);
+        if (workers_stopping) // queues drained above, so handed-off callbacks all ran
+            return;
+    }
+}
@@ -0,0 +1,161 @@
+#ifndef TIMER_SCHEDULER_HPP
+#define TIMER_SCHEDULER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @class TimerScheduler
+ * @brief Runs callbacks when their deadlines pass, using one dispatcher thread instead of polling.
+ *
+ * With Timer alone the only way to act on expiry is to poll time_up(), which burns a core when
+ * many timers are in flight. A TimerScheduler keeps registered deadlines in a min-heap; its
+ * dispatcher thread sleeps until the earliest deadline (or until a new, earlier task arrives),
+ * then drains every task that has expired and fires the callbacks as one batch outside the lock.
+ * CPU cost is driven by expirations, not by how many timers exist or how often you would have
+ * polled.
+ *
+ * By default callbacks run on the dispatcher thread; keep them short or hand work off to your
+ * own executor. When many timers expire at once (a cron-like top-of-minute herd), a single
+ * thread serializes the callbacks and stretches the burst out — construct the scheduler with a
+ * worker count to parallelize the fan-out instead. Expiry detection stays centralized in the
+ * dispatcher, which deals expired callbacks round-robin into per-worker queues; an idle worker
+ * steals from its neighbours' queues, so an uneven deal (or uneven callback costs) still keeps
+ * every core busy until the herd is drained.
+ *
+ * Example usage:
+ * @code
+ * TimerScheduler scheduler(std::thread::hardware_concurrency()); // parallel fan-out
+ * scheduler.schedule(5.0, [] { flush_metrics(); });
+ * auto heartbeat = scheduler.schedule_repeating(1.0, [] { send_heartbeat(); });
+ * // ...
+ * scheduler.cancel(heartbeat);
+ * @endcode
+ */
+class TimerScheduler {
+  public:
+    /** @brief The callback type fired on expiry. */
+    using Callback = std::function<void()>;
+
+    /** @brief Identifies a scheduled task for cancellation. */
+    using TaskId = std::uint64_t;
+
+    /**
+     * @brief Construct the scheduler and start its dispatcher thread. Callbacks run on the
+     *        dispatcher.
+     */
+    TimerScheduler();
+
+    /**
+     * @brief Construct the scheduler with a pool of worker threads for parallel callback fan-out.
+     *
+     * @param worker_count The number of worker threads to run callbacks on. Zero means no
+     *        workers: callbacks run on the dispatcher thread, as with the default constructor.
+     */
+    explicit TimerScheduler(std::size_t worker_count);
+
+    /**
+     * @brief Stops the dispatcher and joins it. Pending tasks that have not expired are dropped;
+     *        callbacks already handed to workers are drained first.
+     */
+    ~TimerScheduler();
+
+    TimerScheduler(const TimerScheduler &) = delete;
+    TimerScheduler &operator=(const TimerScheduler &) = delete;
+
+    /**
+     * @brief Schedule a one-shot callback to fire after `delay_seconds`.
+     *
+     * @return A task id usable with cancel().
+     */
+    TaskId schedule(double delay_seconds, Callback callback);
+
+    /**
+     * @brief Schedule a callback to fire every `interval_seconds` until cancelled.
+     *
+     * The next deadline is advanced from the previous deadline (not from when the callback ran),
+     * so repeated firings do not drift.
+     *
+     * @return A task id usable with cancel().
+     */
+    TaskId schedule_repeating(double interval_seconds, Callback callback);
+
+    /**
+     * @brief Cancel a scheduled task.
+     *
+     * @return true if the task was still pending; false if it already fired (for one-shots) or
+     *         was already cancelled. A callback currently executing is not interrupted.
+     */
+    bool cancel(TaskId id);
+
+    /**
+     * @brief Stop the dispatcher thread. Called automatically by the destructor; idempotent.
+     */
+    void stop();
+
+  private:
+    struct Task {
+        std::chrono::steady_clock::time_point deadline;
+        TaskId id;
+        std::chrono::steady_clock::duration interval; // zero for one-shot tasks
+        Callback callback;
+    };
+
+    /** @brief Orders the heap so the earliest deadline is on top. */
+    struct LaterDeadline {
+        bool operator()(const Task &a, const Task &b) const { return a.deadline > b.deadline; }
+    };
+
+    /** @brief One worker's callback queue. The owner pops the front; thieves steal from the back. */
+    struct Worker {
+        std::deque<Callback> queue;
+        std::mutex queue_mutex;
+    };
+
+    /** @brief The dispatcher thread body: sleep until the earliest deadline, fire expired tasks in batches. */
+    void run();
+
+    /** @brief Deal a batch of expired callbacks round-robin into the worker queues and wake the pool. */
+    void dispatch_to_workers(std::vector<Task> &batch);
+
+    /** @brief A worker thread body: drain own queue, steal from neighbours, sleep when the pool is idle. */
+    void work(std::size_t self);
+
+    /** @brief Pop from worker `self`'s queue, or steal from the first non-empty neighbour. */
+    bool take(std::size_t self, Callback &out);
+
+    std::priority_queue<Task, std::vector<Task>, LaterDeadline> tasks;
+
+    /** @brief Ids of tasks still pending (in the heap and not cancelled); cancel() answers from this. */
+    std::unordered_set<TaskId> pending;
+
+    /** @brief Cancelled ids awaiting removal; each is erased when its task surfaces, so the set stays bounded. */
+    std::unordered_set<TaskId> cancelled;
+    TaskId next_id;
+    bool stopping;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::thread dispatcher;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> worker_threads;
+    std::size_t next_worker = 0; // round-robin dealing cursor; touched only by the dispatcher
+
+    /** @brief Callbacks dealt to workers but not yet started; lets idle workers sleep on `work_ready`. */
+    std::atomic<std::size_t> pending_callbacks{0};
+    bool workers_stopping = false; // guarded by work_mutex
+    std::mutex work_mutex;
+    std::condition_variable work_ready;
+};
+
+#endif // TIMER_SCHEDULER_HPP
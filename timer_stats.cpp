@@ -0,0 +1,32 @@
+#include "timer_stats.hpp"
+
+namespace {
+
+thread_local TimerStatsReport thread_report{};
+
+// index of the histogram bucket covering `overshoot_nanoseconds`: 0 for zero, otherwise one past
+// the position of the highest set bit
+std::size_t bucket_for(std::int64_t overshoot_nanoseconds) {
+    std::size_t bucket = 0;
+    while (overshoot_nanoseconds > 0) {
+        overshoot_nanoseconds >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+} // namespace
+
+void TimerStatsThreadLocal::record_poll(bool /*expired*/, std::int64_t overshoot_nanoseconds) noexcept {
+    thread_report.polls++;
+    if (overshoot_nanoseconds >= 0) {
+        thread_report.expiries++;
+        thread_report.overshoot_buckets[bucket_for(overshoot_nanoseconds)]++;
+    }
+}
+
+TimerStatsReport drain_timer_stats() noexcept {
+    TimerStatsReport report = thread_report;
+    thread_report = TimerStatsReport{};
+    return report;
+}
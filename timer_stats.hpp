@@ -0,0 +1,68 @@
+#ifndef TIMER_STATS_HPP
+#define TIMER_STATS_HPP
+
+#include "timer.hpp"
+
+#include <cstdint>
+
+/**
+ * @file timer_stats.hpp
+ * @brief Opt-in timer instrumentation: poll counts and expiry-overshoot histograms.
+ *
+ * The default build (BasicTimer with TimerStatsOff) pays zero bytes and zero cycles for
+ * instrumentation. Instantiate with TimerStatsThreadLocal instead — e.g. the InstrumentedTimer
+ * alias below — and every time_up() increments a per-thread poll counter, and the first true
+ * time_up() after each expiry records the overshoot (now minus deadline, i.e. how late the
+ * expiry was observed) into a per-thread power-of-two histogram. Drain the numbers periodically
+ * with drain_timer_stats().
+ *
+ * Counters are thread-local, so recording is a couple of plain increments with no atomics or
+ * sharing; each polling thread drains its own report.
+ */
+
+/**
+ * @struct TimerStatsReport
+ * @brief The counters accumulated by TimerStatsThreadLocal on one thread.
+ */
+struct TimerStatsReport {
+    /** @brief Total time_up() polls recorded. */
+    std::uint64_t polls;
+
+    /** @brief Expiries whose overshoot was recorded (one per start/expiry cycle). */
+    std::uint64_t expiries;
+
+    /**
+     * @brief Overshoot histogram with power-of-two nanosecond buckets.
+     *
+     * Bucket `b` counts expiries observed with overshoot in [2^(b-1), 2^b) nanoseconds
+     * (bucket 0 is exactly zero overshoot). Bucket 30 is ~1s.
+     */
+    std::uint64_t overshoot_buckets[64];
+};
+
+/**
+ * @struct TimerStatsThreadLocal
+ * @brief Stats policy recording into per-thread counters; plug into BasicTimer's Stats parameter.
+ */
+struct TimerStatsThreadLocal {
+    /** @brief Selects the instrumented code path at compile time. */
+    static constexpr bool enabled = true;
+
+    /**
+     * @brief Record one poll, and the expiry overshoot when this poll first observed an expiry.
+     *
+     * @param expired Whether the poll saw the timer expired.
+     * @param overshoot_nanoseconds now minus deadline for a first observation, negative otherwise.
+     */
+    static void record_poll(bool expired, std::int64_t overshoot_nanoseconds) noexcept;
+};
+
+/**
+ * @brief Return the calling thread's accumulated counters and reset them to zero.
+ */
+TimerStatsReport drain_timer_stats() noexcept;
+
+/** @brief A steady-clock timer with per-thread poll/overshoot instrumentation enabled. */
+using InstrumentedTimer = BasicTimer<std::chrono::steady_clock, TimerStatsThreadLocal>;
+
+#endif // TIMER_STATS_HPP
@@ -0,0 +1,63 @@
+#ifndef TIMER_WAIT_HPP
+#define TIMER_WAIT_HPP
+
+#include "timer.hpp"
+
+#include <thread>
+
+/**
+ * @file timer_wait.hpp
+ * @brief Blocking waits on timer expiry with sub-millisecond precision.
+ *
+ * `sleep_for(get_remaining_time())` overshoots the deadline by the scheduler quantum (~1-2ms),
+ * while a pure spin loop burns a core. wait_until_expired() does the standard hybrid: coarse
+ * sleeps that deliberately stop short of the deadline by `spin_threshold_seconds`, then a
+ * processor-pause spin for the final stretch. The result is overshoot in the microseconds at
+ * roughly zero extra CPU, since only the last couple of milliseconds are spun.
+ *
+ * Only meaningful for timers on real clocks; a timer on a manually advanced clock (VirtualClock)
+ * would spin forever waiting for someone else to advance time.
+ */
+
+/** @brief One polite spin iteration: tells the core we're busy-waiting. */
+inline void timer_spin_pause() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+/**
+ * @brief Block until `timer` expires: coarse sleep to near the deadline, then spin.
+ *
+ * @param timer The timer to wait on. Must be running: a timer that was never started or is
+ *        paused can never expire, so the call returns immediately instead of sleeping (or
+ *        spinning) on a deadline that does not exist.
+ * @param spin_threshold_seconds How far before the deadline to stop sleeping and start
+ *        spinning. The default (2ms) covers a typical scheduler quantum; raise it if your
+ *        kernel's sleep granularity is coarser, lower it to trade precision for a little CPU.
+ */
+template <typename Clock, typename Stats>
+inline void wait_until_expired(const BasicTimer<Clock, Stats> &timer, double spin_threshold_seconds = 0.002) {
+    if (!timer.is_running())
+        return; // no deadline to wait for: unstarted never expires, paused stays frozen
+    for (;;) {
+        double remaining = timer.get_remaining_time();
+        if (remaining <= 0.0 && timer.time_up())
+            return;
+        if (remaining > spin_threshold_seconds) {
+            // stop short of the deadline; the scheduler may hold us up to a quantum longer
+            std::this_thread::sleep_for(std::chrono::duration<double>(remaining - spin_threshold_seconds));
+        } else {
+            // final stretch: pause-spin for microsecond-level wakeup precision
+            while (!timer.time_up())
+                timer_spin_pause();
+            return;
+        }
+    }
+}
+
+#endif // TIMER_WAIT_HPP
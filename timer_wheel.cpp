@@ -0,0 +1,138 @@
+#include "timer_wheel.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+TimerWheel::TimerWheel(double tick_resolution_seconds, std::size_t num_slots)
+    : tick(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(tick_resolution_seconds))),
+      slots(num_slots), current(), primed(false), count(0), soonest(), soonest_known(false) {
+
+    if (tick_resolution_seconds <= 0.0) {
+        throw std::invalid_argument("TimerWheel tick resolution must be positive");
+    }
+    if (tick <= std::chrono::steady_clock::duration::zero()) {
+        // a positive resolution finer than the clock's granularity truncates to a zero-length
+        // tick, which slot bucketing would divide by
+        throw std::invalid_argument("TimerWheel tick resolution must be at least one clock tick");
+    }
+    if (num_slots == 0) {
+        throw std::invalid_argument("TimerWheel must have at least one slot");
+    }
+}
+
+void TimerWheel::start(Timer &timer) { start(timer, std::chrono::steady_clock::now()); }
+
+void TimerWheel::start(Timer &timer, std::chrono::steady_clock::time_point now) {
+    timer.start(now);
+    insert(timer, now);
+}
+
+void TimerWheel::insert(Timer &timer) { insert(timer, std::chrono::steady_clock::now()); }
+
+void TimerWheel::insert(Timer &timer, std::chrono::steady_clock::time_point now) {
+    if (!timer.is_running()) {
+        // a never-started or paused timer has no real deadline; deriving one from its remaining
+        // time would make advance() report it expired while time_up() says otherwise
+        return;
+    }
+    double remaining = timer.get_remaining_time(now);
+    auto deadline = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              std::chrono::duration<double>(remaining));
+    if (!primed || now < current) {
+        current = now;
+        primed = true;
+    }
+    // a deadline in the cursor's own tick (or earlier) hashes to a slot the cursor has already
+    // passed and would not surface until the next full revolution; clamp the slot — not the
+    // deadline — into the next slot advance() drains. drain_slot() still checks the exact
+    // deadline, so this never fires a timer early.
+    slots[slot_for(std::max(deadline, current + tick))].push_back(Entry{&timer, deadline});
+    count++;
+    if (soonest_known && deadline < soonest) {
+        soonest = deadline;
+    } else if (count == 1) {
+        soonest = deadline;
+        soonest_known = true;
+    }
+}
+
+void TimerWheel::remove(const Timer &timer) {
+    for (auto &slot : slots) {
+        auto removed_from = std::remove_if(slot.begin(), slot.end(),
+                                           [&](const Entry &entry) { return entry.timer == &timer; });
+        if (removed_from != slot.end()) {
+            soonest_known = false; // the removed entry may have been the soonest
+            count -= static_cast<std::size_t>(slot.end() - removed_from);
+            slot.erase(removed_from, slot.end());
+        }
+    }
+}
+
+void TimerWheel::advance(std::vector<Timer *> &expired_out) {
+    advance(std::chrono::steady_clock::now(), expired_out);
+}
+
+void TimerWheel::advance(std::chrono::steady_clock::time_point now, std::vector<Timer *> &expired_out) {
+    expired_out.clear();
+    if (!primed || now <= current) {
+        return;
+    }
+
+    auto first_tick = current.time_since_epoch() / tick;
+    auto last_tick = now.time_since_epoch() / tick;
+    auto ticks_passed = last_tick - first_tick;
+
+    if (ticks_passed >= static_cast<decltype(ticks_passed)>(slots.size())) {
+        // the clock jumped more than a full revolution; every slot may hold expired entries
+        for (std::size_t i = 0; i < slots.size(); i++) {
+            drain_slot(i, now, expired_out);
+        }
+    } else {
+        for (auto t = first_tick + 1; t <= last_tick; t++) {
+            drain_slot(static_cast<std::size_t>(t) % slots.size(), now, expired_out);
+        }
+    }
+    current = now;
+}
+
+std::size_t TimerWheel::size() const { return count; }
+
+std::optional<std::chrono::steady_clock::time_point> TimerWheel::next_deadline() const {
+    if (count == 0)
+        return std::nullopt;
+    if (!soonest_known) {
+        // amortized recomputation: only reached after the cached soonest entry left the wheel
+        bool first = true;
+        for (const auto &slot : slots) {
+            for (const Entry &entry : slot) {
+                if (first || entry.deadline < soonest) {
+                    soonest = entry.deadline;
+                    first = false;
+                }
+            }
+        }
+        soonest_known = true;
+    }
+    return soonest;
+}
+
+std::size_t TimerWheel::slot_for(std::chrono::steady_clock::time_point deadline) const {
+    return static_cast<std::size_t>(deadline.time_since_epoch() / tick) % slots.size();
+}
+
+void TimerWheel::drain_slot(std::size_t slot_index, std::chrono::steady_clock::time_point now,
+                            std::vector<Timer *> &expired_out) {
+    auto &slot = slots[slot_index];
+    // entries that hash to this slot but belong to a later revolution stay where they are
+    auto expired_from = std::partition(slot.begin(), slot.end(),
+                                       [&](const Entry &entry) { return entry.deadline > now; });
+    if (expired_from != slot.end()) {
+        soonest_known = false; // the expired entries may have included the soonest
+        for (auto it = expired_from; it != slot.end(); ++it) {
+            expired_out.push_back(it->timer);
+        }
+        count -= static_cast<std::size_t>(slot.end() - expired_from);
+        slot.erase(expired_from, slot.end());
+    }
+}
@@ -0,0 +1,146 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include "timer.hpp"
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+/**
+ * @class TimerWheel
+ * @brief A hashed timing wheel for bulk expiry of many Timer instances.
+ *
+ * Polling a large collection of timers by calling time_up() on each one costs O(total timers)
+ * per tick even when nothing expires. A TimerWheel hashes each registered timer's deadline into
+ * one of a fixed number of slots; a single advance() call walks only the slots the clock has
+ * passed since the last advance and returns the timers that actually expired, making the
+ * per-tick cost proportional to the number of expired timers rather than the number registered.
+ *
+ * The wheel does not own the timers: callers keep ownership and must ensure a registered Timer
+ * outlives its registration (or call remove() before destroying it).
+ *
+ * Example usage:
+ * @code
+ * TimerWheel wheel;
+ * std::vector<Timer> session_timers(40000, Timer(30.0));
+ * for (auto &t : session_timers)
+ *     wheel.start(t); // starts the timer and registers it in one step
+ *
+ * std::vector<Timer *> expired;
+ * while (true) {
+ *     wheel.advance(expired); // only the timers that expired this tick
+ *     for (Timer *t : expired)
+ *         handle_idle_session(t);
+ *     sleep_until_next_tick();
+ * }
+ * @endcode
+ */
+class TimerWheel {
+  public:
+    /**
+     * @brief Construct a timer wheel.
+     *
+     * @param tick_resolution_seconds The granularity of one wheel slot. Deadlines are bucketed at
+     *        this resolution; expiry is still checked against the exact deadline, so a coarse
+     *        resolution never fires a timer early, it only controls how entries spread over slots.
+     * @param num_slots The number of hash slots. More slots mean fewer collisions between timers
+     *        whose deadlines are many ticks apart.
+     */
+    explicit TimerWheel(double tick_resolution_seconds = 0.001, std::size_t num_slots = 256);
+
+    /**
+     * @brief Start a timer and register it in the wheel with a single clock read.
+     */
+    void start(Timer &timer);
+
+    /**
+     * @brief Cached-clock version of start(): starts and registers relative to the supplied `now`.
+     */
+    void start(Timer &timer, std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Register an already-running timer.
+     *
+     * The deadline is derived from the timer's remaining time, costing one clock read. Timers
+     * that are not running (never started, or paused) are ignored: they have no real deadline
+     * to register.
+     */
+    void insert(Timer &timer);
+
+    /**
+     * @brief Cached-clock version of insert().
+     */
+    void insert(Timer &timer, std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Remove a timer from the wheel without expiring it.
+     *
+     * Safe to call for timers that are not registered; in that case it does nothing.
+     */
+    void remove(const Timer &timer);
+
+    /**
+     * @brief Advance the wheel to the current time and collect expired timers.
+     *
+     * @param expired_out Cleared, then filled with every registered timer whose deadline has
+     *        passed. Expired timers are removed from the wheel; re-register them after restarting.
+     */
+    void advance(std::vector<Timer *> &expired_out);
+
+    /**
+     * @brief Cached-clock version of advance(): expiry is judged against the supplied `now`.
+     */
+    void advance(std::chrono::steady_clock::time_point now, std::vector<Timer *> &expired_out);
+
+    /**
+     * @brief The number of timers currently registered.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief The earliest deadline across every registered timer, if any.
+     *
+     * Intended for event loops deciding how long they may sleep: sleep until the returned time
+     * point instead of waking on a fixed cadence. The value is cached and maintained
+     * incrementally, so calls are O(1) amortized (a full recomputation only happens after the
+     * cached soonest entry has been removed or has expired).
+     */
+    std::optional<std::chrono::steady_clock::time_point> next_deadline() const;
+
+  private:
+    struct Entry {
+        Timer *timer;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    /** @brief Compute the slot a deadline hashes into. */
+    std::size_t slot_for(std::chrono::steady_clock::time_point deadline) const;
+
+    /** @brief Move expired entries from one slot into the output vector. */
+    void drain_slot(std::size_t slot_index, std::chrono::steady_clock::time_point now,
+                    std::vector<Timer *> &expired_out);
+
+    /** @brief The duration covered by one wheel slot. */
+    std::chrono::steady_clock::duration tick;
+
+    /** @brief The hash slots; each holds the entries whose deadlines map to it. */
+    std::vector<std::vector<Entry>> slots;
+
+    /** @brief The time the wheel was last advanced to. */
+    std::chrono::steady_clock::time_point current;
+
+    /** @brief Whether `current` holds a meaningful position yet. */
+    bool primed;
+
+    /** @brief The number of registered entries across all slots. */
+    std::size_t count;
+
+    /** @brief Cached earliest deadline; only meaningful while `soonest_known` is true. */
+    mutable std::chrono::steady_clock::time_point soonest;
+
+    /** @brief Whether `soonest` is up to date (cleared when the soonest entry may have left the wheel). */
+    mutable bool soonest_known;
+};
+
+#endif // TIMER_WHEEL_HPP
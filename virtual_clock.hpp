@@ -0,0 +1,37 @@
+#ifndef VIRTUAL_CLOCK_HPP
+#define VIRTUAL_CLOCK_HPP
+
+#include "manual_clock.hpp"
+
+/**
+ * @file virtual_clock.hpp
+ * @brief A manually advanced time source for deterministic replay and fast-forward simulation.
+ *
+ * VirtualClock is the replay timeline of ManualAccumulatorClock: time only moves when advance()
+ * or set() is called, which makes timer behavior exactly reproducible across runs and lets a
+ * replay pipeline step a two-hour session forward as fast as the CPU allows instead of at wall
+ * speed. It is a timeline of its own, so replay tooling never perturbs timers on the frame-loop
+ * clock (FrameClock) or on real clocks.
+ *
+ * The clock is a single shared (static, atomic) time source: every VirtualTimer reads the same
+ * virtual now, so one advance() moves the whole simulation. It starts at zero; call reset()
+ * between runs.
+ *
+ * Example usage:
+ * @code
+ * VirtualTimer respawn(30.0, true);
+ * while (replay.has_events()) {
+ *     VirtualClock::advance(replay.next_event_delta_seconds());
+ *     if (respawn.time_up_and_try_to_restart())
+ *         spawn_entity();
+ * }
+ * @endcode
+ */
+
+/** @brief The replay/simulation timeline. */
+using VirtualClock = ManualAccumulatorClock<struct virtual_timeline_tag>;
+
+/** @brief A timer driven by manually advanced virtual time. */
+using VirtualTimer = BasicTimer<VirtualClock>;
+
+#endif // VIRTUAL_CLOCK_HPP